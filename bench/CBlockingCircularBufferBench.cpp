@@ -0,0 +1,85 @@
+#include "CMutexCircularBuffer.h"
+
+#include <lib/CBlockingCircularBuffer/CBlockingCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock clock_type;
+
+struct CBlockingConsumer {
+  CBlockingCircularBuffer<int64_t> queue;
+
+  explicit CBlockingConsumer(size_t capacity) : queue(capacity) {}
+
+  void Push(int64_t item) {
+    queue.Push(item);
+  }
+
+  int64_t Pop() {
+    int64_t item = 0;
+    queue.Pop(item);
+
+    return item;
+  }
+};
+
+struct CPollingConsumer {
+  CMutexCircularBuffer<int64_t> queue;
+
+  explicit CPollingConsumer(size_t capacity) : queue(capacity) {}
+
+  void Push(int64_t item) {
+    while (!queue.TryPush(item))
+      std::this_thread::yield();
+  }
+
+  int64_t Pop() {
+    int64_t item = 0;
+    while (!queue.TryPop(item))
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+
+    return item;
+  }
+};
+
+int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now().time_since_epoch()).count();
+}
+
+}
+
+template<typename Consumer>
+static void BM_HandoffLatency(benchmark::State& state) {
+  size_t messages = state.range(0);
+  std::chrono::microseconds pace(state.range(1));
+  std::vector<int64_t> latencies;
+  latencies.reserve(messages * 8);
+  for (auto _ : state) {
+    Consumer consumer(64);
+    std::thread producer([&] {
+      for (size_t i = 0; i < messages; ++i) {
+        std::this_thread::sleep_for(pace);
+        consumer.Push(Now());
+      }
+    });
+    for (size_t i = 0; i < messages; ++i) {
+      int64_t sent = consumer.Pop();
+      latencies.push_back(Now() - sent);
+    }
+    producer.join();
+  }
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["p50_ns"] = double(latencies[latencies.size() / 2]);
+  state.counters["p99_ns"] = double(latencies[latencies.size() * 99 / 100]);
+  state.SetItemsProcessed(latencies.size());
+}
+
+BENCHMARK_TEMPLATE(BM_HandoffLatency, CBlockingConsumer)->Args({200, 100})->Iterations(5)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_HandoffLatency, CPollingConsumer)->Args({200, 100})->Iterations(5)->UseRealTime();
@@ -0,0 +1,57 @@
+#include <lib/CBroadcastCircularBuffer/CBroadcastCircularBuffer.h>
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+struct CMessage {
+  int64_t values[16];
+};
+
+constexpr size_t kBatch = 1024;
+
+}
+
+static void BM_CopyPerReader(benchmark::State& state) {
+  std::vector<CCircularBuffer<CMessage>> buffers(state.range(0), CCircularBuffer<CMessage>(kBatch));
+  CMessage message{};
+  int64_t sum = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < kBatch; ++i) {
+      message.values[0] = i;
+      for (auto& buffer : buffers)
+        buffer.PushBack(message);
+    }
+    for (auto& buffer : buffers) {
+      while (!buffer.Empty())
+        sum += buffer.ExtractFront().values[0];
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+static void BM_Broadcast(benchmark::State& state) {
+  CBroadcastCircularBuffer<CMessage> ring(kBatch, state.range(0));
+  std::vector<CBroadcastCircularBuffer<CMessage>::Reader> readers;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    readers.push_back(ring.AddReader());
+  CMessage message{};
+  int64_t sum = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < kBatch; ++i) {
+      message.values[0] = i;
+      ring.Push(message);
+    }
+    for (auto& reader : readers)
+      reader.Consume([&](const CMessage& item) { sum += item.values[0]; });
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+BENCHMARK(BM_CopyPerReader)->DenseRange(1, 4);
+BENCHMARK(BM_Broadcast)->DenseRange(1, 4);
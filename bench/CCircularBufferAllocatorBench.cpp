@@ -0,0 +1,92 @@
+#include <lib/CCircularBufferAllocator/CCircularBufferAllocator.h>
+#include <lib/CCircularBufferExt/CCircularBufferExt.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+
+namespace {
+
+constexpr int kRingsPerRequest = 16;
+
+class CCountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+template<typename Alloc>
+void CreateDestroyRings(const Alloc& alloc, int elements) {
+  for (int ring = 0; ring < kRingsPerRequest; ++ring) {
+    CCircularBufferExt<int, Alloc> buffer(alloc);
+    for (int i = 0; i < elements; ++i)
+      buffer.PushBack(i);
+    benchmark::DoNotOptimize(buffer.Back());
+  }
+}
+
+void ReportAllocations(benchmark::State& state, const CCountingResource& upstream) {
+  state.counters["upstream_allocs"] = benchmark::Counter(double(upstream.allocations),
+                                                         benchmark::Counter::kAvgIterations);
+  state.SetItemsProcessed(state.iterations() * kRingsPerRequest);
+}
+
+}
+
+static void BM_CreateDestroyStdAllocator(benchmark::State& state) {
+  for (auto _ : state)
+    CreateDestroyRings(std::allocator<int>(), state.range(0));
+  state.SetItemsProcessed(state.iterations() * kRingsPerRequest);
+}
+
+static void BM_CreateDestroyHeap(benchmark::State& state) {
+  CCountingResource upstream;
+  for (auto _ : state)
+    CreateDestroyRings(std::pmr::polymorphic_allocator<int>(&upstream), state.range(0));
+  ReportAllocations(state, upstream);
+}
+
+static void BM_CreateDestroyPool(benchmark::State& state) {
+  CCountingResource upstream;
+  CPoolResource pool(&upstream);
+  for (auto _ : state)
+    CreateDestroyRings(CPoolAllocator<int>(&pool), state.range(0));
+  ReportAllocations(state, upstream);
+}
+
+static void BM_CreateDestroyArena(benchmark::State& state) {
+  CCountingResource upstream;
+  CArenaResource arena(&upstream);
+  for (auto _ : state) {
+    CreateDestroyRings(CArenaAllocator<int>(&arena), state.range(0));
+    arena.Release();
+  }
+  ReportAllocations(state, upstream);
+}
+
+static void BM_CreateDestroyPmrPool(benchmark::State& state) {
+  CCountingResource upstream;
+  std::pmr::unsynchronized_pool_resource pool(&upstream);
+  for (auto _ : state)
+    CreateDestroyRings(std::pmr::polymorphic_allocator<int>(&pool), state.range(0));
+  ReportAllocations(state, upstream);
+}
+
+BENCHMARK(BM_CreateDestroyStdAllocator)->Arg(64)->Arg(1024);
+BENCHMARK(BM_CreateDestroyHeap)->Arg(64)->Arg(1024);
+BENCHMARK(BM_CreateDestroyPool)->Arg(64)->Arg(1024);
+BENCHMARK(BM_CreateDestroyArena)->Arg(64)->Arg(1024);
+BENCHMARK(BM_CreateDestroyPmrPool)->Arg(64)->Arg(1024);
@@ -0,0 +1,63 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <vector>
+
+static void BM_PushBackLoop(benchmark::State& state) {
+  CCircularBuffer<float> buffer(8192);
+  std::vector<float> batch(state.range(0));
+  std::iota(batch.begin(), batch.end(), 0.0f);
+
+  for (auto _ : state) {
+    for (float item : batch)
+      buffer.PushBack(item);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+static void BM_PushBackSpan(benchmark::State& state) {
+  CCircularBuffer<float> buffer(8192);
+  std::vector<float> batch(state.range(0));
+  std::iota(batch.begin(), batch.end(), 0.0f);
+
+  for (auto _ : state) {
+    buffer.PushBack(batch);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+static void BM_DrainLoop(benchmark::State& state) {
+  CCircularBuffer<float> buffer(8192);
+  std::vector<float> batch(state.range(0));
+
+  for (auto _ : state) {
+    buffer.PushBack(batch);
+    for (auto& item : batch) {
+      item = buffer.Front();
+      buffer.PopFront();
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+static void BM_DrainReadInto(benchmark::State& state) {
+  CCircularBuffer<float> buffer(8192);
+  std::vector<float> batch(state.range(0));
+
+  for (auto _ : state) {
+    buffer.PushBack(batch);
+    buffer.ReadInto(batch);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+BENCHMARK(BM_PushBackLoop)->Arg(256)->Arg(4096);
+BENCHMARK(BM_PushBackSpan)->Arg(256)->Arg(4096);
+BENCHMARK(BM_DrainLoop)->Arg(256)->Arg(4096);
+BENCHMARK(BM_DrainReadInto)->Arg(256)->Arg(4096);
@@ -0,0 +1,102 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template<typename Container>
+static Container MakeFilled(size_t size) {
+  std::mt19937 rng(7);
+  Container container(size);
+  for (size_t i = 0; i < size + size / 3; ++i) {
+    if constexpr (std::is_same_v<Container, CCircularBuffer<int>>)
+      container.PushBack(int(rng() % 1000000));
+    else
+      container[i % size] = int(rng() % 1000000);
+  }
+
+  return container;
+}
+
+template<typename Container>
+static void BM_Sort(benchmark::State& state) {
+  Container source = MakeFilled<Container>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container = source;
+    state.ResumeTiming();
+    std::sort(container.begin(), container.end());
+    benchmark::DoNotOptimize(container);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SortLinearized(benchmark::State& state) {
+  CCircularBuffer<int> source = MakeFilled<CCircularBuffer<int>>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    CCircularBuffer<int> container = source;
+    state.ResumeTiming();
+    std::span<int> data = container.Linearize();
+    std::sort(data.begin(), data.end());
+    benchmark::DoNotOptimize(container);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+static void BM_Find(benchmark::State& state) {
+  Container container = MakeFilled<Container>(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(std::find(container.begin(), container.end(), -1));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_FindSegmented(benchmark::State& state) {
+  CCircularBuffer<int> container = MakeFilled<CCircularBuffer<int>>(state.range(0));
+  for (auto _ : state) {
+    bool found = false;
+    container.ForEachSegment([&found](std::span<const int> segment) {
+      found |= std::find(segment.begin(), segment.end(), -1) != segment.end();
+    });
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+static void BM_Accumulate(benchmark::State& state) {
+  Container container = MakeFilled<Container>(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(std::accumulate(container.begin(), container.end(), int64_t(0)));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_AccumulateSegmented(benchmark::State& state) {
+  CCircularBuffer<int> container = MakeFilled<CCircularBuffer<int>>(state.range(0));
+  for (auto _ : state) {
+    int64_t sum = 0;
+    container.ForEachSegment([&sum](std::span<const int> segment) {
+      sum = std::accumulate(segment.begin(), segment.end(), sum);
+    });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Sort, CCircularBuffer<int>)->Arg(1 << 16);
+BENCHMARK(BM_SortLinearized)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Sort, std::vector<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Sort, std::deque<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Find, CCircularBuffer<int>)->Arg(1 << 16);
+BENCHMARK(BM_FindSegmented)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Find, std::vector<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Find, std::deque<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Accumulate, CCircularBuffer<int>)->Arg(1 << 16);
+BENCHMARK(BM_AccumulateSegmented)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Accumulate, std::vector<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_Accumulate, std::deque<int>)->Arg(1 << 16);
@@ -0,0 +1,77 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+#include <lib/CCircularBufferSimd/CCircularBufferSimd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+
+template<typename T>
+static CCircularBuffer<T> MakeWrapped(size_t capacity) {
+  CCircularBuffer<T> buffer(capacity);
+  for (size_t i = 0; i < capacity + capacity / 3; ++i)
+    buffer.PushBack(T(i % 97));
+
+  return buffer;
+}
+
+template<typename T>
+static void BM_SumIterator(benchmark::State& state) {
+  CCircularBuffer<T> buffer = MakeWrapped<T>(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(std::accumulate(buffer.begin(), buffer.end(), T(0)));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T, ESimdLevel Level>
+static void BM_Sum(benchmark::State& state) {
+  if (DetectSimdLevel() < Level)
+    return state.SkipWithError("SIMD level is not supported");
+  CCircularBuffer<T> buffer = MakeWrapped<T>(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(AggregateSum(buffer, Level));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+static void BM_MaxIterator(benchmark::State& state) {
+  CCircularBuffer<T> buffer = MakeWrapped<T>(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(*std::max_element(buffer.begin(), buffer.end()));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T, ESimdLevel Level>
+static void BM_Max(benchmark::State& state) {
+  if (DetectSimdLevel() < Level)
+    return state.SkipWithError("SIMD level is not supported");
+  CCircularBuffer<T> buffer = MakeWrapped<T>(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(AggregateMax(buffer, Level));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T, ESimdLevel Level>
+static void BM_CountAbove(benchmark::State& state) {
+  if (DetectSimdLevel() < Level)
+    return state.SkipWithError("SIMD level is not supported");
+  CCircularBuffer<T> buffer = MakeWrapped<T>(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(AggregateCountAbove(buffer, T(50), Level));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define SIMD_BENCHMARKS(T)                                                          \
+  BENCHMARK_TEMPLATE(BM_SumIterator, T)->Range(64, 1 << 16);                        \
+  BENCHMARK_TEMPLATE(BM_Sum, T, ESimdLevel::kScalar)->Range(64, 1 << 16);           \
+  BENCHMARK_TEMPLATE(BM_Sum, T, ESimdLevel::kSse2)->Range(64, 1 << 16);             \
+  BENCHMARK_TEMPLATE(BM_Sum, T, ESimdLevel::kAvx2)->Range(64, 1 << 16);             \
+  BENCHMARK_TEMPLATE(BM_MaxIterator, T)->Range(64, 1 << 16);                        \
+  BENCHMARK_TEMPLATE(BM_Max, T, ESimdLevel::kScalar)->Range(64, 1 << 16);           \
+  BENCHMARK_TEMPLATE(BM_Max, T, ESimdLevel::kAvx2)->Range(64, 1 << 16);             \
+  BENCHMARK_TEMPLATE(BM_CountAbove, T, ESimdLevel::kScalar)->Range(64, 1 << 16);    \
+  BENCHMARK_TEMPLATE(BM_CountAbove, T, ESimdLevel::kAvx2)->Range(64, 1 << 16)
+
+SIMD_BENCHMARKS(float);
+SIMD_BENCHMARKS(double);
+SIMD_BENCHMARKS(int64_t);
@@ -0,0 +1,286 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+#include <lib/CCircularBufferExt/CCircularBufferExt.h>
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct CPod64 {
+  int values[16];
+};
+
+template<typename T>
+using Fixed = CCircularBuffer<T>;
+
+template<typename T>
+using Ext = CCircularBufferExt<T>;
+
+template<typename T>
+using Deque = std::deque<T>;
+
+template<typename T>
+using Vector = std::vector<T>;
+
+template<typename T>
+T MakeValue(size_t i) {
+  if constexpr (std::is_same_v<T, std::string>)
+    return std::string(32, char('a' + i % 26));
+  else if constexpr (std::is_same_v<T, CPod64>)
+    return CPod64{{int(i)}};
+  else
+    return T(i);
+}
+
+template<typename Container>
+constexpr bool kIsRing = requires(Container& c) { c.Capacity(); };
+
+template<typename Container>
+Container Make(size_t capacity) {
+  if constexpr (kIsRing<Container>)
+    return Container(capacity);
+  else
+    return Container();
+}
+
+template<typename Container>
+Container MakeFilled(size_t n, size_t capacity) {
+  Container c = Make<Container>(capacity);
+  for (size_t i = 0; i < n; ++i) {
+    if constexpr (kIsRing<Container>)
+      c.PushBack(MakeValue<typename Container::value_type>(i));
+    else
+      c.push_back(MakeValue<typename Container::value_type>(i));
+  }
+
+  return c;
+}
+
+template<typename Container, typename T>
+void PushBack(Container& c, T&& value) {
+  if constexpr (kIsRing<Container>)
+    c.PushBack(std::forward<T>(value));
+  else
+    c.push_back(std::forward<T>(value));
+}
+
+template<typename Container, typename T>
+void PushFront(Container& c, T&& value) {
+  if constexpr (kIsRing<Container>)
+    c.PushFront(std::forward<T>(value));
+  else
+    c.push_front(std::forward<T>(value));
+}
+
+template<typename Container>
+void PopFront(Container& c) {
+  if constexpr (kIsRing<Container>)
+    c.PopFront();
+  else
+    c.pop_front();
+}
+
+template<typename Container>
+void PopBack(Container& c) {
+  if constexpr (kIsRing<Container>)
+    c.PopBack();
+  else
+    c.pop_back();
+}
+
+template<typename Container, typename T>
+void Insert(Container& c, size_t index, T&& value) {
+  if constexpr (kIsRing<Container>)
+    c.Insert(c.cbegin() + index, std::forward<T>(value));
+  else
+    c.insert(c.cbegin() + index, std::forward<T>(value));
+}
+
+template<typename Container>
+void Erase(Container& c, size_t index) {
+  if constexpr (kIsRing<Container>)
+    c.Erase(c.cbegin() + index);
+  else
+    c.erase(c.cbegin() + index);
+}
+
+template<typename Container>
+void Reserve(Container& c, size_t capacity) {
+  if constexpr (kIsRing<Container>)
+    c.Reserve(capacity);
+  else
+    c.reserve(capacity);
+}
+
+}
+
+template<typename Container>
+static void BM_PushBack(benchmark::State& state) {
+  typedef typename Container::value_type value_type;
+  size_t n = state.range(0);
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    Container c = Make<Container>(n);
+    for (size_t i = 0; i < n; ++i)
+      PushBack(c, value);
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Container>
+static void BM_PushFront(benchmark::State& state) {
+  typedef typename Container::value_type value_type;
+  size_t n = state.range(0);
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    Container c = Make<Container>(n);
+    for (size_t i = 0; i < n; ++i)
+      PushFront(c, value);
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Container>
+static void BM_PushPopFront(benchmark::State& state) {
+  typedef typename Container::value_type value_type;
+  size_t n = state.range(0);
+  Container c = MakeFilled<Container>(n, n + 1);
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    PushBack(c, value);
+    PopFront(c);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Container>
+static void BM_PushPopBack(benchmark::State& state) {
+  typedef typename Container::value_type value_type;
+  size_t n = state.range(0);
+  Container c = MakeFilled<Container>(n, n + 1);
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    PushBack(c, value);
+    PopBack(c);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Container>
+static void BM_IndexAccess(benchmark::State& state) {
+  size_t n = state.range(0);
+  Container c = MakeFilled<Container>(n, n);
+  for (auto _ : state) {
+    for (size_t i = 0, j = 0; i < n; ++i, j = (j + 7) % n)
+      benchmark::DoNotOptimize(c[j]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Container>
+static void BM_Iterate(benchmark::State& state) {
+  size_t n = state.range(0);
+  Container c = MakeFilled<Container>(n, n);
+  for (auto _ : state) {
+    for (const auto& item : c)
+      benchmark::DoNotOptimize(item);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Container>
+static void BM_InsertErase(benchmark::State& state) {
+  typedef typename Container::value_type value_type;
+  size_t n = state.range(0);
+  size_t index = n * state.range(1) / 100;
+  Container c = MakeFilled<Container>(n, n + 1);
+  value_type value = MakeValue<value_type>(1);
+  for (auto _ : state) {
+    Insert(c, index, value);
+    Erase(c, index);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Container>
+static void BM_ReserveGrowth(benchmark::State& state) {
+  size_t n = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container c = MakeFilled<Container>(n, n);
+    state.ResumeTiming();
+    Reserve(c, 2 * n);
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Container>
+static void BM_CopyConstruct(benchmark::State& state) {
+  size_t n = state.range(0);
+  Container c = MakeFilled<Container>(n, n);
+  for (auto _ : state) {
+    Container copy(c);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void Sizes(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(16)->Range(64, 16384);
+}
+
+static void InsertPositions(benchmark::internal::Benchmark* b) {
+  b->ArgsProduct({{64, 4096}, {0, 50, 100}});
+}
+
+#define C_CIRCULAR_BUFFER_BENCHMARK(func, Container, apply) \
+  BENCHMARK_TEMPLATE(func, Container<int>)->Apply(apply);    \
+  BENCHMARK_TEMPLATE(func, Container<CPod64>)->Apply(apply); \
+  BENCHMARK_TEMPLATE(func, Container<std::string>)->Apply(apply)
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushBack, Fixed, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushBack, Ext, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushBack, Deque, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushBack, Vector, Sizes);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushFront, Fixed, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushFront, Ext, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushFront, Deque, Sizes);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushPopFront, Fixed, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushPopFront, Deque, Sizes);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushPopBack, Fixed, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushPopBack, Deque, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_PushPopBack, Vector, Sizes);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_IndexAccess, Fixed, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_IndexAccess, Deque, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_IndexAccess, Vector, Sizes);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_Iterate, Fixed, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_Iterate, Deque, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_Iterate, Vector, Sizes);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_InsertErase, Fixed, InsertPositions);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_InsertErase, Deque, InsertPositions);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_InsertErase, Vector, InsertPositions);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_ReserveGrowth, Ext, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_ReserveGrowth, Vector, Sizes);
+
+C_CIRCULAR_BUFFER_BENCHMARK(BM_CopyConstruct, Fixed, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_CopyConstruct, Deque, Sizes);
+C_CIRCULAR_BUFFER_BENCHMARK(BM_CopyConstruct, Vector, Sizes);
+
+#undef C_CIRCULAR_BUFFER_BENCHMARK
@@ -0,0 +1,24 @@
+#include "CMutexCircularBuffer.h"
+
+#include <lib/CMpmcCircularBuffer/CMpmcCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+template<typename Queue>
+static void BM_PushPopScaling(benchmark::State& state) {
+  static Queue queue(1024);
+
+  int64_t item = state.thread_index();
+  for (auto _ : state) {
+    while (!queue.TryPush(item))
+      std::this_thread::yield();
+    while (!queue.TryPop(item))
+      std::this_thread::yield();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_PushPopScaling, CMpmcCircularBuffer<int64_t>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPopScaling, CMutexCircularBuffer<int64_t>)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+
+#include <mutex>
+
+template<typename T>
+class CMutexCircularBuffer {
+ public:
+  explicit CMutexCircularBuffer(size_t capacity) : buffer_(capacity) {}
+
+  void Push(const T& item) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_.PushBack(item);
+  }
+
+  bool TryPush(const T& item) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer_.Full())
+      return false;
+    buffer_.PushBack(item);
+    return true;
+  }
+
+  bool TryPop(T& item) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer_.Empty())
+      return false;
+    item = buffer_.ExtractFront();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  CCircularBuffer<T> buffer_;
+};
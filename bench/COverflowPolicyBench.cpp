@@ -0,0 +1,63 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+#include <lib/CCircularBufferExt/CCircularBufferExt.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+struct IPushSink {
+  virtual ~IPushSink() = default;
+
+  virtual void PushBack(const int& item) = 0;
+};
+
+template<typename Buffer>
+struct CVirtualPushSink : IPushSink {
+  Buffer buffer;
+
+  explicit CVirtualPushSink(size_t capacity) : buffer(capacity) {}
+
+  void PushBack(const int& item) override {
+    buffer.PushBack(item);
+  }
+};
+
+template<typename Buffer>
+static void BM_PushLoop(benchmark::State& state) {
+  Buffer buffer(state.range(0));
+  for (auto _ : state) {
+    for (int i = 0; i < 1024; ++i)
+      buffer.PushBack(i);
+    benchmark::DoNotOptimize(buffer.Back());
+  }
+  state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+template<typename Buffer>
+static void BM_VirtualPushLoop(benchmark::State& state) {
+  std::unique_ptr<IPushSink> sink = std::make_unique<CVirtualPushSink<Buffer>>(state.range(0));
+  IPushSink* target = sink.get();
+  benchmark::DoNotOptimize(target);
+  for (auto _ : state) {
+    for (int i = 0; i < 1024; ++i)
+      target->PushBack(i);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+template<typename Buffer>
+static void BM_ExtPushLoop(benchmark::State& state) {
+  for (auto _ : state) {
+    Buffer buffer;
+    for (int i = 0; i < state.range(0); ++i)
+      buffer.PushBack(i);
+    benchmark::DoNotOptimize(buffer.Back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushLoop, CCircularBuffer<int>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_PushLoop, CCircularBuffer<int, std::allocator<int>, CRejectOverflow>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_VirtualPushLoop, CCircularBuffer<int>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_ExtPushLoop, CCircularBufferExt<int>)->Arg(4096);
@@ -0,0 +1,59 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+#include <lib/CPow2CircularBuffer/CPow2CircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+template<typename Buffer>
+static void BM_PushPop(benchmark::State& state) {
+  Buffer buffer(state.range(0));
+  for (size_t i = 0; i < buffer.Capacity() / 2; ++i)
+    buffer.PushBack(int(i));
+
+  int value = 0;
+  for (auto _ : state) {
+    buffer.PushBack(value++);
+    benchmark::DoNotOptimize(buffer.Front());
+    buffer.PopFront();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Buffer>
+static void BM_PushOverwrite(benchmark::State& state) {
+  Buffer buffer(state.range(0));
+
+  int value = 0;
+  for (auto _ : state) {
+    buffer.PushBack(value++);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Buffer>
+static void BM_RandomIndex(benchmark::State& state) {
+  Buffer buffer(state.range(0));
+  for (size_t i = 0; i < buffer.Capacity() * 3 / 2; ++i)
+    buffer.PushBack(int(i));
+
+  std::mt19937 rng(42);
+  std::vector<size_t> indices(4096);
+  for (auto& index : indices)
+    index = rng() % buffer.Size();
+
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buffer[indices[i++ & 4095]]);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_PushPop, CCircularBuffer<int>)->Arg(1024)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PushPop, CPow2CircularBuffer<int>)->Arg(1024)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PushOverwrite, CCircularBuffer<int>)->Arg(1024)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PushOverwrite, CPow2CircularBuffer<int>)->Arg(1024)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_RandomIndex, CCircularBuffer<int>)->Arg(1024)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_RandomIndex, CPow2CircularBuffer<int>)->Arg(1024)->Arg(1 << 16);
@@ -0,0 +1,32 @@
+#include "CMutexCircularBuffer.h"
+
+#include <lib/CShardedCircularBuffer/CShardedCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+template<typename Buffer>
+Buffer& Instance();
+
+template<>
+CShardedCircularBuffer<int64_t>& Instance() {
+  static CShardedCircularBuffer<int64_t> buffer(4096, 32);
+  return buffer;
+}
+
+template<>
+CMutexCircularBuffer<int64_t>& Instance() {
+  static CMutexCircularBuffer<int64_t> buffer(4096 * 32);
+  return buffer;
+}
+
+template<typename Buffer>
+static void BM_ProducerScaling(benchmark::State& state) {
+  Buffer& buffer = Instance<Buffer>();
+  int64_t item = state.thread_index();
+  for (auto _ : state)
+    buffer.Push(item++);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_ProducerScaling, CShardedCircularBuffer<int64_t>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducerScaling, CMutexCircularBuffer<int64_t>)->ThreadRange(1, 32)->UseRealTime();
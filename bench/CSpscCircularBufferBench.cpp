@@ -0,0 +1,96 @@
+#include "CMutexCircularBuffer.h"
+
+#include <lib/CSpscCircularBuffer/CSpscCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <vector>
+
+template<typename Queue>
+static void BM_Throughput(benchmark::State& state) {
+  Queue queue(1024);
+  std::atomic<bool> done(false);
+
+  std::thread consumer([&queue, &done]() {
+    int64_t item;
+    while (!done.load(std::memory_order_relaxed)) {
+      while (queue.TryPop(item))
+        benchmark::DoNotOptimize(item);
+      std::this_thread::yield();
+    }
+  });
+
+  int64_t value = 0;
+  for (auto _ : state) {
+    while (!queue.TryPush(value))
+      std::this_thread::yield();
+    ++value;
+  }
+  done.store(true);
+  consumer.join();
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SpscBatchThroughput(benchmark::State& state) {
+  CSpscCircularBuffer<int64_t> queue(1024);
+  std::atomic<bool> done(false);
+  const size_t batch_size = state.range(0);
+
+  std::thread consumer([&queue, &done, batch_size]() {
+    std::vector<int64_t> batch(batch_size);
+    while (!done.load(std::memory_order_relaxed))
+      if (queue.TryPopN(batch.begin(), batch_size) == 0)
+        std::this_thread::yield();
+  });
+
+  std::vector<int64_t> batch(batch_size, 1);
+  for (auto _ : state) {
+    for (size_t pushed = 0; pushed < batch_size;) {
+      size_t n = queue.TryPushN(batch.begin() + pushed, batch_size - pushed);
+      if (n == 0)
+        std::this_thread::yield();
+      pushed += n;
+    }
+  }
+  done.store(true);
+  consumer.join();
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+template<typename Queue>
+static void BM_RoundTripLatency(benchmark::State& state) {
+  Queue ping(64);
+  Queue pong(64);
+  std::atomic<bool> done(false);
+
+  std::thread echo([&ping, &pong, &done]() {
+    int64_t item;
+    while (!done.load(std::memory_order_relaxed)) {
+      if (ping.TryPop(item)) {
+        while (!pong.TryPush(item))
+          std::this_thread::yield();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int64_t value = 0;
+  int64_t item;
+  for (auto _ : state) {
+    while (!ping.TryPush(value))
+      std::this_thread::yield();
+    while (!pong.TryPop(item))
+      std::this_thread::yield();
+    ++value;
+  }
+  done.store(true);
+  echo.join();
+}
+
+BENCHMARK_TEMPLATE(BM_Throughput, CSpscCircularBuffer<int64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Throughput, CMutexCircularBuffer<int64_t>)->UseRealTime();
+BENCHMARK(BM_SpscBatchThroughput)->Arg(16)->Arg(256)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RoundTripLatency, CSpscCircularBuffer<int64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RoundTripLatency, CMutexCircularBuffer<int64_t>)->UseRealTime();
@@ -0,0 +1,63 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+#include <lib/CTimeSeriesCircularBuffer/CTimeSeriesCircularBuffer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+namespace {
+
+typedef CTimeSample<double, int64_t> CSample;
+
+constexpr size_t kSamples = 1 << 16;
+
+template<typename Buffer>
+void Fill(Buffer& buffer) {
+  for (size_t i = 0; i < kSamples + kSamples / 3; ++i) {
+    if constexpr (requires { buffer.PushBack(CSample{}); })
+      buffer.PushBack(CSample{int64_t(i), double(i % 7)});
+    else
+      buffer.Push(int64_t(i), double(i % 7));
+  }
+}
+
+}
+
+static void BM_IteratorLowerBound(benchmark::State& state) {
+  CCircularBuffer<CSample> buffer(kSamples);
+  Fill(buffer);
+  int64_t from = buffer.Back().timestamp - state.range(0);
+  for (auto _ : state) {
+    auto it = std::lower_bound(buffer.begin(), buffer.end(), from,
+                               [](const CSample& sample, int64_t t) { return sample.timestamp < t; });
+    double sum = 0;
+    for (; it != buffer.end(); ++it)
+      sum += it->value;
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void BM_RangeByTimeSum(benchmark::State& state) {
+  CTimeSeriesCircularBuffer<double> series(kSamples);
+  Fill(series);
+  int64_t from = series.Latest().timestamp - state.range(0);
+  for (auto _ : state) {
+    double sum = 0;
+    for (const auto& segment : series.RangeByTime(from, series.Latest().timestamp + 1)) {
+      for (const CSample& sample : segment)
+        sum += sample.value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void BM_AggregateLast(benchmark::State& state) {
+  CTimeSeriesCircularBuffer<double> series(kSamples);
+  Fill(series);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(series.AggregateLast(state.range(0)));
+}
+
+BENCHMARK(BM_IteratorLowerBound)->Arg(64)->Arg(16384);
+BENCHMARK(BM_RangeByTimeSum)->Arg(64)->Arg(16384);
+BENCHMARK(BM_AggregateLast)->Arg(64)->Arg(16384);
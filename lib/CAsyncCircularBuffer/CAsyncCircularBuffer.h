@@ -0,0 +1,158 @@
+#pragma once
+
+#include "CAsyncExecutor.h"
+
+#include <algorithm>
+#include <optional>
+
+template<typename T, typename Alloc = std::allocator<T>>
+class CAsyncCircularBuffer {
+ public:
+  typedef typename Alloc::value_type value_type;
+  typedef Alloc allocator_type;
+  typedef size_t size_type;
+
+  class PopAwaiter {
+    friend class CAsyncCircularBuffer;
+
+   private:
+    CAsyncCircularBuffer& channel_;
+    std::coroutine_handle<> handle_;
+    std::optional<value_type> item_;
+
+   public:
+    explicit PopAwaiter(CAsyncCircularBuffer& channel) : channel_(channel) {}
+
+    PopAwaiter(const PopAwaiter&) = delete;
+
+    PopAwaiter& operator=(const PopAwaiter&) = delete;
+
+    bool await_ready() {
+      if (!channel_.buffer_.Empty() && channel_.producers_.Empty()) {
+        item_.emplace(channel_.buffer_.ExtractFront());
+        return true;
+      }
+
+      return channel_.buffer_.Empty() && channel_.closed_;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle) {
+      if (channel_.buffer_.Empty()) {
+        handle_ = handle;
+        channel_.consumers_.PushBack(this);
+        return std::noop_coroutine();
+      }
+      item_.emplace(channel_.buffer_.ExtractFront());
+      PushAwaiter* producer = channel_.producers_.ExtractFront();
+      channel_.buffer_.PushBack(std::move(producer->item_));
+      producer->pushed_ = true;
+      channel_.executor_.Post(handle);
+
+      return producer->handle_;
+    }
+
+    std::optional<value_type> await_resume() {
+      return std::move(item_);
+    }
+  };
+
+  class PushAwaiter {
+    friend class CAsyncCircularBuffer;
+
+   private:
+    CAsyncCircularBuffer& channel_;
+    std::coroutine_handle<> handle_;
+    value_type item_;
+    bool pushed_;
+
+   public:
+    template<typename U>
+    PushAwaiter(CAsyncCircularBuffer& channel, U&& item)
+        : channel_(channel), item_(std::forward<U>(item)), pushed_(false) {}
+
+    PushAwaiter(const PushAwaiter&) = delete;
+
+    PushAwaiter& operator=(const PushAwaiter&) = delete;
+
+    bool await_ready() {
+      if (channel_.closed_)
+        return true;
+      if (channel_.consumers_.Empty() && !channel_.buffer_.Full()) {
+        channel_.buffer_.PushBack(std::move(item_));
+        pushed_ = true;
+      }
+
+      return pushed_;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle) {
+      handle_ = handle;
+      if (channel_.consumers_.Empty()) {
+        channel_.producers_.PushBack(this);
+        return std::noop_coroutine();
+      }
+      PopAwaiter* consumer = channel_.consumers_.ExtractFront();
+      consumer->item_.emplace(std::move(item_));
+      pushed_ = true;
+      channel_.executor_.Post(handle);
+
+      return consumer->handle_;
+    }
+
+    bool await_resume() const {
+      return pushed_;
+    }
+  };
+
+ protected:
+  CAsyncExecutor& executor_;
+  CCircularBuffer<T, Alloc> buffer_;
+  CCircularBufferExt<PopAwaiter*> consumers_;
+  CCircularBufferExt<PushAwaiter*> producers_;
+  bool closed_;
+
+ public:
+  CAsyncCircularBuffer(CAsyncExecutor& executor, size_type capacity, const allocator_type& alloc = allocator_type())
+      : executor_(executor), buffer_(std::max<size_type>(capacity, 1), alloc), closed_(false) {}
+
+  CAsyncCircularBuffer(const CAsyncCircularBuffer&) = delete;
+
+  CAsyncCircularBuffer& operator=(const CAsyncCircularBuffer&) = delete;
+
+  size_type Size() const {
+    return buffer_.Size();
+  }
+
+  bool Empty() const {
+    return buffer_.Empty();
+  }
+
+  size_type Capacity() const {
+    return buffer_.Capacity();
+  }
+
+  bool Closed() const {
+    return closed_;
+  }
+
+  PopAwaiter Pop() {
+    return PopAwaiter(*this);
+  }
+
+  PushAwaiter Push(const value_type& item) {
+    return PushAwaiter(*this, item);
+  }
+
+  PushAwaiter Push(value_type&& item) {
+    return PushAwaiter(*this, std::move(item));
+  }
+
+  void Close() {
+    closed_ = true;
+    while (!consumers_.Empty())
+      executor_.Post(consumers_.ExtractFront()->handle_);
+    while (!producers_.Empty())
+      executor_.Post(producers_.ExtractFront()->handle_);
+  }
+
+};
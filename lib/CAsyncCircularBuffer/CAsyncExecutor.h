@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../CCircularBufferExt/CCircularBufferExt.h"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+class CAsyncExecutor;
+
+class CAsyncTask {
+ public:
+  struct promise_type {
+    CAsyncTask get_return_object() {
+      return CAsyncTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept {
+      return {};
+    }
+
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+
+    void return_void() {}
+
+    void unhandled_exception();
+  };
+
+ private:
+  std::coroutine_handle<promise_type> handle_;
+
+ public:
+  explicit CAsyncTask(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  CAsyncTask(CAsyncTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+  CAsyncTask& operator=(CAsyncTask&& other) noexcept {
+    if (this != &other) {
+      if (handle_)
+        handle_.destroy();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+
+    return *this;
+  }
+
+  ~CAsyncTask() {
+    if (handle_)
+      handle_.destroy();
+  }
+
+  std::coroutine_handle<> Release() {
+    return std::exchange(handle_, nullptr);
+  }
+
+};
+
+class CAsyncExecutor {
+  friend struct CAsyncTask::promise_type;
+
+ private:
+  CCircularBufferExt<std::coroutine_handle<>> ready_;
+  std::exception_ptr exception_;
+
+  static inline thread_local CAsyncExecutor* current_ = nullptr;
+
+ public:
+  CAsyncExecutor() = default;
+
+  CAsyncExecutor(const CAsyncExecutor&) = delete;
+
+  CAsyncExecutor& operator=(const CAsyncExecutor&) = delete;
+
+  void Post(std::coroutine_handle<> handle) {
+    ready_.PushBack(handle);
+  }
+
+  void Spawn(CAsyncTask task) {
+    Post(task.Release());
+  }
+
+  bool RunOne() {
+    if (ready_.Empty())
+      return false;
+    CAsyncExecutor* previous = std::exchange(current_, this);
+    ready_.ExtractFront().resume();
+    current_ = previous;
+    if (exception_)
+      std::rethrow_exception(std::exchange(exception_, nullptr));
+
+    return true;
+  }
+
+  size_t Run() {
+    size_t resumed = 0;
+    while (RunOne())
+      ++resumed;
+
+    return resumed;
+  }
+
+  size_t Pending() const {
+    return ready_.Size();
+  }
+
+};
+
+inline void CAsyncTask::promise_type::unhandled_exception() {
+  CAsyncExecutor* executor = CAsyncExecutor::current_;
+  if (!executor)
+    std::terminate();
+  if (!executor->exception_)
+    executor->exception_ = std::current_exception();
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "../CCircularBuffer/CCircularBuffer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <span>
+#include <utility>
+
+enum class EFullPolicy {
+  kBlock,
+  kDropOldest,
+  kFail
+};
+
+template<typename T, typename Alloc = std::allocator<T>>
+class CBlockingCircularBuffer {
+ public:
+  typedef typename Alloc::value_type value_type;
+  typedef Alloc allocator_type;
+  typedef size_t size_type;
+
+ protected:
+  typedef std::chrono::steady_clock clock_type;
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  CCircularBuffer<T, Alloc> buffer_;
+  EFullPolicy full_policy_;
+  size_type wake_batch_;
+  size_type waiting_consumers_;
+  size_type waiting_producers_;
+  bool closed_;
+
+ public:
+  explicit CBlockingCircularBuffer(size_type capacity, EFullPolicy full_policy = EFullPolicy::kBlock,
+                                   size_type wake_batch = 1, const allocator_type& alloc = allocator_type())
+      : buffer_(std::max<size_type>(capacity, 1), alloc), full_policy_(full_policy),
+        wake_batch_(std::clamp<size_type>(wake_batch, 1, std::max<size_type>(capacity, 1))),
+        waiting_consumers_(0), waiting_producers_(0), closed_(false) {}
+
+  CBlockingCircularBuffer(const CBlockingCircularBuffer&) = delete;
+
+  CBlockingCircularBuffer& operator=(const CBlockingCircularBuffer&) = delete;
+
+  size_type Capacity() const {
+    return buffer_.Capacity();
+  }
+
+  size_type Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffer_.Size();
+  }
+
+  bool Empty() const {
+    return Size() == 0;
+  }
+
+  EFullPolicy FullPolicy() const {
+    return full_policy_;
+  }
+
+  size_type WakeBatch() const {
+    return wake_batch_;
+  }
+
+  size_type WaitingConsumers() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return waiting_consumers_;
+  }
+
+  size_type WaitingProducers() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return waiting_producers_;
+  }
+
+  bool Push(const value_type& item) {
+    return Emplace(clock_type::time_point::max(), item);
+  }
+
+  bool Push(value_type&& item) {
+    return Emplace(clock_type::time_point::max(), std::move(item));
+  }
+
+  template<typename Rep, typename Period>
+  bool Push(const value_type& item, const std::chrono::duration<Rep, Period>& timeout) {
+    return Emplace(Deadline(timeout), item);
+  }
+
+  template<typename Rep, typename Period>
+  bool Push(value_type&& item, const std::chrono::duration<Rep, Period>& timeout) {
+    return Emplace(Deadline(timeout), std::move(item));
+  }
+
+  bool Pop(value_type& item) {
+    return PopBatch(std::span<value_type>(&item, 1)) == 1;
+  }
+
+  template<typename Rep, typename Period>
+  bool Pop(value_type& item, const std::chrono::duration<Rep, Period>& timeout) {
+    return PopBatch(std::span<value_type>(&item, 1), timeout) == 1;
+  }
+
+  size_type PopBatch(std::span<value_type> out) {
+    return PopUntil(out, clock_type::time_point::max());
+  }
+
+  template<typename Rep, typename Period>
+  size_type PopBatch(std::span<value_type> out, const std::chrono::duration<Rep, Period>& timeout) {
+    return PopUntil(out, Deadline(timeout));
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool notify = !buffer_.Empty() && waiting_consumers_ > 0;
+    lock.unlock();
+    if (notify)
+      not_empty_.notify_all();
+  }
+
+  void Close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  bool Closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+ private:
+  template<typename Rep, typename Period>
+  static clock_type::time_point Deadline(const std::chrono::duration<Rep, Period>& timeout) {
+    clock_type::time_point now = clock_type::now();
+    if (std::chrono::duration<double>(timeout) >= std::chrono::duration<double>(clock_type::time_point::max() - now))
+      return clock_type::time_point::max();
+
+    return now + std::chrono::ceil<clock_type::duration>(timeout);
+  }
+
+  template<typename Condition, typename Predicate>
+  static bool WaitUntil(Condition& condition, std::unique_lock<std::mutex>& lock, clock_type::time_point deadline,
+                        Predicate ready) {
+    if (deadline == clock_type::time_point::max()) {
+      condition.wait(lock, ready);
+      return true;
+    }
+
+    return condition.wait_until(lock, deadline, ready);
+  }
+
+  bool Ready() const {
+    return !buffer_.Empty() || closed_;
+  }
+
+  template<typename... Args>
+  bool Emplace(clock_type::time_point deadline, Args&& ... args) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_)
+      return false;
+    if (buffer_.Full()) {
+      if (full_policy_ == EFullPolicy::kFail)
+        return false;
+      if (full_policy_ == EFullPolicy::kBlock) {
+        ++waiting_producers_;
+        bool ready = WaitUntil(not_full_, lock, deadline, [this] { return !buffer_.Full() || closed_; });
+        --waiting_producers_;
+        if (!ready || closed_)
+          return false;
+      }
+    }
+    buffer_.EmplaceBack(std::forward<Args>(args)...);
+    bool notify = waiting_consumers_ > 0 && buffer_.Size() >= wake_batch_;
+    lock.unlock();
+    if (notify)
+      not_empty_.notify_one();
+
+    return true;
+  }
+
+  size_type PopUntil(std::span<value_type> out, clock_type::time_point deadline) {
+    if (out.empty())
+      return 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!Ready()) {
+      ++waiting_consumers_;
+      WaitUntil(not_empty_, lock, deadline, [this] { return Ready(); });
+      --waiting_consumers_;
+    }
+    size_type n = buffer_.ReadInto(out);
+    bool notify = n > 0 && waiting_producers_ > 0;
+    lock.unlock();
+    if (notify && n > 1)
+      not_full_.notify_all();
+    else if (notify)
+      not_full_.notify_one();
+
+    return n;
+  }
+
+};
@@ -0,0 +1,265 @@
+#pragma once
+
+#include "../CCircularBufferCommon/CacheLine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+enum class ESlowReaderPolicy {
+  kGate,
+  kOverrun
+};
+
+template<typename T, ESlowReaderPolicy Policy = ESlowReaderPolicy::kGate, typename Alloc = std::allocator<T>>
+class CBroadcastCircularBuffer {
+  static_assert(Policy == ESlowReaderPolicy::kGate || std::is_trivially_copyable_v<T>,
+                "overrun readers copy slots the writer may be replacing");
+
+ public:
+  typedef typename Alloc::value_type value_type;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef Alloc allocator_type;
+  typedef size_t size_type;
+
+  class Reader;
+
+ protected:
+  struct alignas(kCacheLineSize) Gate {
+    std::atomic<size_type> sequence;
+    std::atomic<bool> active;
+  };
+
+  typedef __gnu_cxx::__alloc_traits<allocator_type> alloc_traits;
+  typedef typename alloc_traits::template rebind<Gate>::other gate_allocator_type;
+  typedef __gnu_cxx::__alloc_traits<gate_allocator_type> gate_alloc_traits;
+
+  pointer slots_;
+  size_type mask_;
+  Gate* gates_;
+  size_type max_readers_;
+  Alloc allocator_;
+  gate_allocator_type gate_allocator_;
+  std::mutex readers_mutex_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> cursor_;
+  std::atomic<size_type> claim_;
+  size_type cached_gate_;
+
+ public:
+  explicit CBroadcastCircularBuffer(size_type capacity, size_type max_readers = 8,
+                                    const allocator_type& alloc = allocator_type())
+      : mask_(std::bit_ceil(std::max<size_type>(capacity, 2)) - 1), max_readers_(std::max<size_type>(max_readers, 1)),
+        allocator_(alloc), gate_allocator_(alloc), cursor_(0), claim_(0), cached_gate_(0) {
+    slots_ = alloc_traits::allocate(allocator_, Capacity());
+    size_type constructed = 0;
+    try {
+      for (; constructed < Capacity(); ++constructed)
+        alloc_traits::construct(allocator_, slots_ + constructed);
+    } catch (...) {
+      DestroySlots(constructed);
+      throw;
+    }
+    gates_ = gate_alloc_traits::allocate(gate_allocator_, max_readers_);
+    for (size_type i = 0; i < max_readers_; ++i)
+      ::new(static_cast<void*>(gates_ + i)) Gate{{0}, {false}};
+  }
+
+  CBroadcastCircularBuffer(const CBroadcastCircularBuffer&) = delete;
+
+  CBroadcastCircularBuffer& operator=(const CBroadcastCircularBuffer&) = delete;
+
+  ~CBroadcastCircularBuffer() {
+    for (size_type i = 0; i < max_readers_; ++i)
+      gates_[i].~Gate();
+    gate_alloc_traits::deallocate(gate_allocator_, gates_, max_readers_);
+    DestroySlots(Capacity());
+  }
+
+  size_type Capacity() const {
+    return mask_ + 1;
+  }
+
+  size_type MaxReaders() const {
+    return max_readers_;
+  }
+
+  size_type Published() const {
+    return cursor_.load(std::memory_order_acquire);
+  }
+
+  Reader AddReader() {
+    std::lock_guard<std::mutex> lock(readers_mutex_);
+    for (size_type i = 0; i < max_readers_; ++i) {
+      if (!gates_[i].active.load(std::memory_order_relaxed)) {
+        gates_[i].sequence.store(cursor_.load());
+        gates_[i].active.store(true);
+        gates_[i].sequence.store(cursor_.load());
+        return Reader(this, i);
+      }
+    }
+
+    throw std::length_error("CBroadcastCircularBuffer: too many readers");
+  }
+
+  bool TryPush(const value_type& item) {
+    return TryEmplace(item);
+  }
+
+  bool TryPush(value_type&& item) {
+    return TryEmplace(std::move(item));
+  }
+
+  void Push(const value_type& item) {
+    while (!TryEmplace(item))
+      std::this_thread::yield();
+  }
+
+  void Push(value_type&& item) {
+    while (!TryEmplace(std::move(item)))
+      std::this_thread::yield();
+  }
+
+  template<typename U>
+  bool TryEmplace(U&& item) {
+    size_type sequence = cursor_.load(std::memory_order_relaxed);
+    if constexpr (Policy == ESlowReaderPolicy::kGate) {
+      if (sequence - cached_gate_ >= Capacity()) {
+        cached_gate_ = MinReaderSequence(sequence);
+        if (sequence - cached_gate_ >= Capacity())
+          return false;
+      }
+    } else {
+      claim_.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+    slots_[sequence & mask_] = std::forward<U>(item);
+    cursor_.store(sequence + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  class Reader {
+    friend class CBroadcastCircularBuffer;
+
+   private:
+    CBroadcastCircularBuffer* ring_;
+    size_type index_;
+    size_type overruns_;
+
+    Reader(CBroadcastCircularBuffer* ring, size_type index) : ring_(ring), index_(index), overruns_(0) {}
+
+   public:
+    Reader(Reader&& other) noexcept
+        : ring_(std::exchange(other.ring_, nullptr)), index_(other.index_), overruns_(other.overruns_) {}
+
+    Reader& operator=(Reader&& other) noexcept {
+      if (this != &other) {
+        Release();
+        ring_ = std::exchange(other.ring_, nullptr);
+        index_ = other.index_;
+        overruns_ = other.overruns_;
+      }
+
+      return *this;
+    }
+
+    ~Reader() {
+      Release();
+    }
+
+    size_type Sequence() const {
+      return GateSlot().sequence.load(std::memory_order_relaxed);
+    }
+
+    size_type Available() const {
+      return ring_->Published() - Sequence();
+    }
+
+    size_type Overruns() const {
+      return overruns_;
+    }
+
+    template<typename Function>
+    size_type Consume(Function&& f, size_type max = std::numeric_limits<size_type>::max())
+        requires(Policy == ESlowReaderPolicy::kGate) {
+      size_type sequence = Sequence();
+      size_type n = std::min(ring_->Published() - sequence, max);
+      for (size_type i = 0; i < n; ++i)
+        f(const_reference(ring_->slots_[(sequence + i) & ring_->mask_]));
+      GateSlot().sequence.store(sequence + n, std::memory_order_release);
+
+      return n;
+    }
+
+    size_type Read(std::span<value_type> out) {
+      size_type sequence = Sequence();
+      size_type published = ring_->Published();
+      if constexpr (Policy == ESlowReaderPolicy::kOverrun)
+        sequence = SkipOverrun(sequence, published);
+      size_type n = std::min(published - sequence, out.size());
+      for (size_type i = 0; i < n; ++i)
+        out[i] = ring_->slots_[(sequence + i) & ring_->mask_];
+      if constexpr (Policy == ESlowReaderPolicy::kOverrun) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        size_type intact = SkipOverrun(sequence, ring_->claim_.load(std::memory_order_relaxed));
+        size_type lost = std::min(intact - sequence, n);
+        std::move(out.begin() + lost, out.begin() + n, out.begin());
+        n -= lost;
+        sequence = intact;
+      }
+      GateSlot().sequence.store(sequence + n, std::memory_order_release);
+
+      return n;
+    }
+
+    bool TryRead(value_type& item) {
+      return Read(std::span<value_type>(&item, 1)) == 1;
+    }
+
+   private:
+    CBroadcastCircularBuffer::Gate& GateSlot() const {
+      return ring_->gates_[index_];
+    }
+
+    size_type SkipOverrun(size_type sequence, size_type published) {
+      if (published - sequence <= ring_->Capacity())
+        return sequence;
+      overruns_ += published - ring_->Capacity() - sequence;
+
+      return published - ring_->Capacity();
+    }
+
+    void Release() {
+      if (ring_)
+        GateSlot().active.store(false, std::memory_order_release);
+    }
+  };
+
+ private:
+  size_type MinReaderSequence(size_type sequence) const {
+    size_type min = sequence;
+    for (size_type i = 0; i < max_readers_; ++i) {
+      if (gates_[i].active.load(std::memory_order_acquire))
+        min = std::min(min, gates_[i].sequence.load(std::memory_order_acquire));
+    }
+
+    return min;
+  }
+
+  void DestroySlots(size_type n) {
+    for (size_type i = 0; i < n; ++i)
+      alloc_traits::destroy(allocator_, slots_ + i);
+    alloc_traits::deallocate(allocator_, slots_, Capacity());
+  }
+
+};
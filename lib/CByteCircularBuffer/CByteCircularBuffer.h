@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../CCircularBuffer/CCircularBuffer.h"
+
+#include <array>
+#include <cerrno>
+#include <span>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+template<typename Alloc = std::allocator<char>>
+class CByteCircularBuffer : public CCircularBuffer<char, Alloc> {
+  typedef CCircularBuffer<char, Alloc> base;
+
+ public:
+  typedef typename base::size_type size_type;
+
+ protected:
+  using base::begin_;
+  using base::end_;
+  using base::first_;
+  using base::last_;
+  using base::size_;
+
+ public:
+  using base::base;
+
+  size_type FreeSize() const {
+    return this->Capacity() - size_;
+  }
+
+  std::array<std::span<char>, 2> FreeSegments() {
+    if (this->Full())
+      return {};
+    if (first_ <= last_)
+      return {std::span<char>(std::to_address(last_), end_ - last_),
+              std::span<char>(std::to_address(begin_), first_ - begin_)};
+
+    return {std::span<char>(std::to_address(last_), first_ - last_), std::span<char>()};
+  }
+
+  void Commit(size_type n) {
+    last_ = this->Add(last_, n);
+    size_ += n;
+  }
+
+  void Consume(size_type n) {
+    this->PopFront(n);
+  }
+
+  ssize_t ReadFrom(int fd) {
+    if (this->Full()) {
+      errno = ENOBUFS;
+      return -1;
+    }
+    std::array<std::span<char>, 2> segments = FreeSegments();
+    iovec iov[2] = {{segments[0].data(), segments[0].size()}, {segments[1].data(), segments[1].size()}};
+    ssize_t n = readv(fd, iov, segments[1].empty() ? 1 : 2);
+    if (n > 0)
+      Commit(n);
+
+    return n;
+  }
+
+  ssize_t WriteTo(int fd) {
+    if (this->Empty())
+      return 0;
+    std::array<std::span<char>, 2> segments = this->Segments();
+    iovec iov[2] = {{segments[0].data(), segments[0].size()}, {segments[1].data(), segments[1].size()}};
+    ssize_t n = writev(fd, iov, segments[1].empty() ? 1 : 2);
+    if (n > 0)
+      Consume(n);
+
+    return n;
+  }
+
+};
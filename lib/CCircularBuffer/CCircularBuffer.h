@@ -1,10 +1,20 @@
 #pragma once
 
+#include "CCircularBufferOverflow.h"
+#include "CCircularBufferStats.h"
 #include "../CCircularBufferIter/CCircularBufferIter.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
 #include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
 
-template<typename T, typename Alloc = std::allocator<T>>
+template<typename T, typename Alloc = std::allocator<T>, typename Overflow = COverwriteOverflow,
+    typename Stats = CNullStats>
 class CCircularBuffer {
  public:
   typedef typename Alloc::value_type value_type;
@@ -12,9 +22,11 @@ class CCircularBuffer {
   typedef const value_type& const_reference;
   typedef value_type* pointer;
   typedef const value_type* const_pointer;
-  typedef CCircularBufferIter<CCircularBuffer<T, Alloc>, nonconst_traits<Alloc>> iterator;
-  typedef CCircularBufferIter<CCircularBuffer<T, Alloc>, const_traits<Alloc>> const_iterator;
+  typedef CCircularBufferIter<CCircularBuffer<T, Alloc, Overflow, Stats>, nonconst_traits<Alloc>> iterator;
+  typedef CCircularBufferIter<CCircularBuffer<T, Alloc, Overflow, Stats>, const_traits<Alloc>> const_iterator;
   typedef Alloc allocator_type;
+  typedef Overflow overflow_policy;
+  typedef Stats stats_policy;
   typedef size_t size_type;
   typedef ptrdiff_t difference_type;
 
@@ -24,7 +36,9 @@ class CCircularBuffer {
   pointer first_;
   pointer last_;
   size_type size_;
-  Alloc allocator_;
+  [[no_unique_address]] Alloc allocator_;
+  [[no_unique_address]] Overflow overflow_;
+  [[no_unique_address]] Stats stats_;
   template<typename Container, typename Traits> friend
   class CCircularBufferIter;
   typedef __gnu_cxx::__alloc_traits<allocator_type> alloc_traits;
@@ -52,21 +66,25 @@ class CCircularBuffer {
     return p - (n > (p - begin_) ? n - (end_ - begin_) : n);
   }
 
+  pointer At(size_type index) const {
+    return Add(first_, index);
+  }
+
  public:
   iterator begin() {
-    return iterator(this, Empty() ? 0 : first_);
+    return iterator(this, 0);
   }
 
   const_iterator begin() const {
-    return const_iterator(this, Empty() ? 0 : first_);
+    return const_iterator(this, 0);
   }
 
   iterator end() {
-    return iterator(this, 0);
+    return iterator(this, Size());
   }
 
   const_iterator end() const {
-    return const_iterator(this, 0);
+    return const_iterator(this, Size());
   }
 
   const_iterator cbegin() const {
@@ -121,6 +139,71 @@ class CCircularBuffer {
     return alloc_traits::max_size(allocator_);
   }
 
+  std::span<value_type> ArrayOne() {
+    return {std::to_address(first_), ArrayOneSize()};
+  }
+
+  std::span<const value_type> ArrayOne() const {
+    return {std::to_address(first_), ArrayOneSize()};
+  }
+
+  std::span<value_type> ArrayTwo() {
+    return {std::to_address(begin_), Size() - ArrayOneSize()};
+  }
+
+  std::span<const value_type> ArrayTwo() const {
+    return {std::to_address(begin_), Size() - ArrayOneSize()};
+  }
+
+  bool IsLinearized() const {
+    return ArrayOneSize() == Size();
+  }
+
+  std::span<value_type> Linearize() {
+    if (IsLinearized())
+      return ArrayOne();
+
+    size_type front_size = end_ - first_;
+    pointer front = last_;
+    if (last_ != first_) {
+      if constexpr (std::is_trivially_copyable_v<value_type>) {
+        std::memmove(std::to_address(last_), std::to_address(first_), front_size * sizeof(value_type));
+      } else {
+        for (pointer src = first_, dest = last_; src != end_; ++src, ++dest) {
+          alloc_traits::construct(allocator_, std::to_address(dest), std::move(*src));
+          alloc_traits::destroy(allocator_, std::to_address(src));
+        }
+      }
+    }
+    std::rotate(begin_, front, front + front_size);
+    first_ = begin_;
+    last_ = Add(begin_, Size());
+
+    return ArrayOne();
+  }
+
+  std::array<std::span<value_type>, 2> Segments() {
+    return {ArrayOne(), ArrayTwo()};
+  }
+
+  std::array<std::span<const value_type>, 2> Segments() const {
+    return {ArrayOne(), ArrayTwo()};
+  }
+
+  template<typename Function>
+  void ForEachSegment(Function f) {
+    f(ArrayOne());
+    if (!IsLinearized())
+      f(ArrayTwo());
+  }
+
+  template<typename Function>
+  void ForEachSegment(Function f) const {
+    f(ArrayOne());
+    if (!IsLinearized())
+      f(ArrayTwo());
+  }
+
   explicit CCircularBuffer(const allocator_type& alloc = allocator_type())
       : allocator_(alloc), begin_(0), end_(0), first_(0), last_(0), size_(0) {}
 
@@ -136,11 +219,20 @@ class CCircularBuffer {
     first_ = last_ = begin_;
   }
 
-  CCircularBuffer(const CCircularBuffer<T, Alloc>& other) : allocator_(Alloc()), size_(other.Size()) {
+  CCircularBuffer(const CCircularBuffer<T, Alloc, Overflow, Stats>& other)
+      : allocator_(alloc_traits::_S_select_on_copy(other.allocator_)), overflow_(other.overflow_),
+        stats_(other.stats_), size_(other.Size()) {
     //Assign(other.begin(), other.end());
       RangeInitialize(other.begin(), other.end(), other.Capacity());
   }
 
+  CCircularBuffer(CCircularBuffer<T, Alloc, Overflow, Stats>&& other) noexcept
+      : begin_(other.begin_), end_(other.end_), first_(other.first_), last_(other.last_), size_(other.size_),
+        allocator_(std::move(other.allocator_)), overflow_(std::move(other.overflow_)),
+        stats_(std::move(other.stats_)) {
+    other.Release();
+  }
+
   template<typename InputIterator, typename = std::_RequireInputIter<InputIterator>>
   CCircularBuffer(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type())
       : allocator_(alloc) {
@@ -152,53 +244,174 @@ class CCircularBuffer {
     RangeInitialize(il.begin(), il.end(), il.size());
   }
 
-  virtual void PushBack(const value_type& item) {
+  void PushBack(const value_type& item) {
+    EmplaceBack(item);
+  }
+
+  void PushBack(value_type&& item) {
+    EmplaceBack(std::move(item));
+  }
+
+  void PushFront(const value_type& item) {
+    EmplaceFront(item);
+  }
+
+  void PushFront(value_type&& item) {
+    EmplaceFront(std::move(item));
+  }
+
+  template<typename... Args>
+  void EmplaceBack(Args&& ... args) {
     if (Full()) {
-      if (Empty())
-        return;
-      *last_ = item;
-      Inc(last_);
-      first_ = last_;
-    } else {
-      alloc_traits::construct(allocator_, std::to_address(last_), item);
-      Inc(last_);
-      ++size_;
+      if constexpr (Overflow::kReallocates) {
+        value_type item(std::forward<Args>(args)...);
+        OverflowBack(overflow_.OnOverflow(*this, Size() + 1), std::move(item));
+      } else {
+        OverflowBack(overflow_.OnOverflow(*this, Size() + 1), std::forward<Args>(args)...);
+      }
+      return;
     }
+    alloc_traits::construct(allocator_, std::to_address(last_), std::forward<Args>(args)...);
+    Inc(last_);
+    ++size_;
+    stats_.OnPush(1, Size());
   }
 
-  virtual void PushFront(const value_type& item) {
+  template<typename... Args>
+  void EmplaceFront(Args&& ... args) {
     if (Full()) {
-      if (Empty())
-        return;
-      Dec(first_);
-      *first_ = item;
-      last_ = first_;
+      if constexpr (Overflow::kReallocates) {
+        value_type item(std::forward<Args>(args)...);
+        OverflowFront(overflow_.OnOverflow(*this, Size() + 1), std::move(item));
+      } else {
+        OverflowFront(overflow_.OnOverflow(*this, Size() + 1), std::forward<Args>(args)...);
+      }
+      return;
+    }
+    Dec(first_);
+    alloc_traits::construct(allocator_, std::to_address(first_), std::forward<Args>(args)...);
+    ++size_;
+    stats_.OnPush(1, Size());
+  }
+
+  void PushBack(std::span<const value_type> items) {
+    PushBackRange(items.begin(), items.end());
+  }
+
+  template<typename InputIterator, typename = std::_RequireInputIter<InputIterator>>
+  void PushBackRange(InputIterator first, InputIterator last) {
+    if constexpr (!std::forward_iterator<InputIterator>) {
+      for (; first != last; ++first)
+        PushBack(*first);
     } else {
-      Dec(first_);
-      alloc_traits::construct(allocator_, std::to_address(first_), item);
-      ++size_;
+      size_type n = std::distance(first, last);
+      if (Size() + n > Capacity()) {
+        EOverflowAction action = overflow_.OnOverflow(*this, Size() + n);
+        if (action == EOverflowAction::kDrop || (action == EOverflowAction::kInsert && Size() + n > Capacity())) {
+          stats_.OnDrop(Size() + n - Capacity());
+          n = Capacity() - Size();
+        } else if (action == EOverflowAction::kOverwrite && Size() + n > Capacity()) {
+          stats_.OnOverwrite(Size() + n - Capacity());
+          if (n >= Capacity()) {
+            stats_.OnPush(n - Capacity(), Size());
+            Clear();
+            std::advance(first, n - Capacity());
+            n = Capacity();
+          } else {
+            DropFront(Size() + n - Capacity());
+          }
+        }
+      }
+      WriteBack(first, n);
+      stats_.OnPush(n, Size());
+    }
+  }
+
+  Overflow& OverflowPolicy() {
+    return overflow_;
+  }
+
+  const Overflow& OverflowPolicy() const {
+    return overflow_;
+  }
+
+  const Stats& Statistics() const {
+    return stats_;
+  }
+
+  void ResetStatistics() {
+    stats_ = Stats();
+  }
+
+  allocator_type GetAllocator() const {
+    return allocator_;
+  }
+
+  void ShrinkToFit() {
+    if (Size() == Capacity())
+      return;
+    if (Empty()) {
+      stats_.OnReallocate(Capacity(), 0, sizeof(value_type));
+      Destroy();
+      Release();
+    } else {
+      Reserve(Size());
     }
   }
 
   void Reserve(size_type new_capacity) {
     if (new_capacity == Capacity())
       return;
+    stats_.OnReallocate(Capacity(), new_capacity, sizeof(value_type));
 
-    CCircularBuffer copy(begin(), end());
-    Destroy();
-    RangeInitialize(copy.begin(), copy.end(), new_capacity);
+    pointer begin = alloc_traits::allocate(allocator_, new_capacity);
+    pointer end = Relocate(begin);
+    Deallocate();
+    first_ = begin_ = begin;
+    end_ = begin_ + new_capacity;
+    last_ = (end == end_ ? begin_ : end);
   }
 
-  CCircularBuffer<T, Alloc>& operator=(const CCircularBuffer<T, Alloc>& other) {
+  CCircularBuffer<T, Alloc, Overflow, Stats>& operator=(const CCircularBuffer<T, Alloc, Overflow, Stats>& other) {
     if (this == &other)
       return *this;
     Destroy();
+    std::__alloc_on_copy(allocator_, other.allocator_);
+    overflow_ = other.overflow_;
+    stats_ = other.stats_;
     RangeInitialize(other.begin(), other.end(), other.Capacity());
 
     return *this;
   }
 
-  CCircularBuffer<T, Alloc>& operator=(std::initializer_list<value_type> other) {
+  CCircularBuffer<T, Alloc, Overflow, Stats>& operator=(CCircularBuffer<T, Alloc, Overflow, Stats>&& other)
+      noexcept(alloc_traits::_S_nothrow_move()) {
+    if (this == &other)
+      return *this;
+    Destroy();
+    if constexpr (!alloc_traits::_S_nothrow_move()) {
+      if (allocator_ != other.allocator_) {
+        overflow_ = std::move(other.overflow_);
+        stats_ = std::move(other.stats_);
+        RangeInitialize(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()),
+                        other.Capacity());
+        return *this;
+      }
+    }
+    begin_ = other.begin_;
+    end_ = other.end_;
+    first_ = other.first_;
+    last_ = other.last_;
+    size_ = other.size_;
+    std::__alloc_on_move(allocator_, other.allocator_);
+    overflow_ = std::move(other.overflow_);
+    stats_ = std::move(other.stats_);
+    other.Release();
+
+    return *this;
+  }
+
+  CCircularBuffer<T, Alloc, Overflow, Stats>& operator=(std::initializer_list<value_type> other) {
     Destroy();
     RangeInitialize(other.begin(), other.end(), other.size());
 
@@ -207,7 +420,7 @@ class CCircularBuffer {
 
   void Assign(size_type n, const value_type& item) {
     Clear();
-    alloc_traits::deallocate(allocator_, std::to_address(begin_), Capacity());
+    Deallocate();
     size_ = n;
     InitializeBuffer(n, item);
     first_ = last_ = begin_;
@@ -216,12 +429,13 @@ class CCircularBuffer {
   template<typename InputIterator, typename = std::_RequireInputIter<InputIterator>>
   void Assign(InputIterator first, InputIterator last) {
     Clear();
-    alloc_traits::deallocate(allocator_, std::to_address(begin_), Capacity());
+    Deallocate();
     RangeInitialize(first, last, last - first);
   }
 
   void Assign(std::initializer_list<value_type> other) {
     Clear();
+    Deallocate();
     RangeInitialize(other.begin(), other.end(), other.size());
   }
 
@@ -229,99 +443,102 @@ class CCircularBuffer {
     Dec(last_);
     alloc_traits::destroy(allocator_, last_);
     --size_;
+    stats_.OnPop(1);
+    Shrink();
   }
 
   void PopFront() {
-    alloc_traits::destroy(allocator_, first_);
-    Inc(first_);
-    --size_;
+    DropFront();
+    stats_.OnPop(1);
+    Shrink();
   }
 
-  iterator Erase(const_iterator pos) {
-    return Erase(pos, pos + 1);
+  void PopFront(size_type n) {
+    DropFront(n);
+    stats_.OnPop(n);
+    Shrink();
   }
 
-  iterator Erase(const_iterator first, const_iterator last) {
-    CCircularBuffer copy(last, cend());
-
-    pointer p = Add(first_, std::distance(cbegin(), first));
-    for (size_t i = 0; i < copy.Size(); ++i) {
-      PopBack();
-    }
+  size_type ReadInto(std::span<value_type> out) {
+    size_type n = std::min(out.size(), Size());
+    std::span<value_type> one = ArrayOne().first(std::min(n, ArrayOneSize()));
+    std::span<value_type> two = ArrayTwo().first(n - one.size());
+    std::move(two.begin(), two.end(), std::move(one.begin(), one.end(), out.begin()));
+    PopFront(n);
 
-    for (size_t i = 0; i < std::distance(first, last); ++i) {
-      PopBack();
-    }
+    return n;
+  }
 
-    for (const auto& item : copy) {
-      PushBack(item);
-    }
+  value_type ExtractBack() {
+    value_type item(std::move(Back()));
+    PopBack();
 
-    return (last_ == p ? end() : iterator(this, p));
+    return item;
   }
 
-  iterator Insert(const_iterator pos, const value_type& item) {
-    return Insert(pos, 1, item);
+  value_type ExtractFront() {
+    value_type item(std::move(Front()));
+    PopFront();
+
+    return item;
   }
 
-  iterator Insert(const_iterator pos, size_type n, const value_type& value) {
-    CCircularBuffer copy(pos, cend());
+  iterator Erase(const_iterator pos) {
+    return Erase(pos, pos + 1);
+  }
 
-    for (size_t i = 0; i < copy.Size(); ++i) {
-      PopBack();
+  iterator Erase(const_iterator first, const_iterator last) {
+    size_type index = first - cbegin();
+    size_type count = last - first;
+    if (count == 0)
+      return IteratorAt(index);
+
+    size_type tail = Size() - index - count;
+    if (index < tail) {
+      MoveBackward(Add(first_, index), Add(first_, index + count), index);
+      for (size_type i = 0; i < count; ++i, Inc(first_))
+        alloc_traits::destroy(allocator_, std::to_address(first_));
+    } else {
+      MoveForward(Add(first_, index + count), Add(first_, index), tail);
+      for (size_type i = 0; i < count; ++i) {
+        Dec(last_);
+        alloc_traits::destroy(allocator_, std::to_address(last_));
+      }
     }
+    size_ -= count;
+    stats_.OnPop(count);
+    Shrink();
 
-    pointer pos_to_insert = last_;
-    for (; n > 0; --n) {
-      if (Full() && pos_to_insert == last_)
-        Inc(pos_to_insert);
-      PushBack(value);
-    }
+    return IteratorAt(index);
+  }
 
-    for (const auto& item : copy) {
-      if (Full() && pos_to_insert == last_)
-        Inc(pos_to_insert);
-      PushBack(item);
-    }
+  iterator Insert(const_iterator pos, const value_type& item) {
+    return Insert(pos, 1, item);
+  }
 
-    return iterator(this, pos_to_insert);
+  iterator Insert(const_iterator pos, size_type n, const value_type& value) {
+    value_type item(value);
+    return InsertN(pos - cbegin(), n, [&item]() -> const value_type& { return item; });
   }
 
   template<typename InputIterator, typename = std::_RequireInputIter<InputIterator>>
   iterator Insert(const_iterator pos, InputIterator first, InputIterator last) {
-    CCircularBuffer copy(pos, cend());
-
-    for (size_t i = 0; i < copy.Size(); ++i) {
-      PopBack();
-    }
-
-    pointer pos_to_insert = last_;
-    for (; first != last; ++first) {
-      if (Full() && pos_to_insert == last_)
-        Inc(pos_to_insert);
-      PushBack(*first);
-    }
-
-    for (const auto& item : copy) {
-      if (Full() && pos_to_insert == last_)
-        Inc(pos_to_insert);
-      PushBack(item);
-    }
-
-    return iterator(this, pos_to_insert);
+    return InsertN(pos - cbegin(), std::distance(first, last), [&first]() -> decltype(auto) { return *first++; });
   }
 
   iterator Insert(const_iterator pos, const std::initializer_list<value_type>& il) {
     return Insert(pos, il.begin(), il.end());
   }
 
-  void swap(CCircularBuffer<T, Alloc>& cb) {
+  void swap(CCircularBuffer<T, Alloc, Overflow, Stats>& cb) {
     std::swap(begin_, cb.begin_);
     std::swap(end_, cb.end_);
     std::swap(first_, cb.first_);
     std::swap(last_, cb.last_);
     std::swap(size_, cb.size_);
-    std::swap(allocator_, cb.allocator_);
+    std::__alloc_on_swap(allocator_, cb.allocator_);
+    std::swap(overflow_, cb.overflow_);
+    std::swap(stats_, cb.stats_);
   }
 
   void Clear() {
@@ -336,6 +553,196 @@ class CCircularBuffer {
 
  private:
 
+  size_type ArrayOneSize() const {
+    if (Empty())
+      return 0;
+    return (first_ < last_ ? last_ : end_) - first_;
+  }
+
+  iterator IteratorAt(size_type index) {
+    return iterator(this, index);
+  }
+
+  template<typename InputIterator>
+  void WriteBack(InputIterator first, size_type n) {
+    size_type chunk = std::min<size_type>(n, end_ - last_);
+    first = WriteSegment(first, last_, chunk);
+    WriteSegment(first, begin_, n - chunk);
+    last_ = Add(last_, n);
+    size_ += n;
+  }
+
+  template<typename InputIterator>
+  InputIterator WriteSegment(InputIterator first, pointer dest, size_type n) {
+    if constexpr (std::contiguous_iterator<InputIterator> && std::is_trivially_copyable_v<value_type>
+        && std::is_same_v<std::iter_value_t<InputIterator>, value_type>) {
+      if (n > 0)
+        std::memcpy(std::to_address(dest), std::to_address(first), n * sizeof(value_type));
+      return first + n;
+    } else {
+      for (; n > 0; --n, ++first, ++dest)
+        alloc_traits::construct(allocator_, std::to_address(dest), *first);
+      return first;
+    }
+  }
+
+  template<typename... Args>
+  void OverflowBack(EOverflowAction action, Args&& ... args) {
+    // The policy may have grown the buffer, so a non-drop action only overwrites if it is still full
+    if (action != EOverflowAction::kDrop && !Full()) {
+      alloc_traits::construct(allocator_, std::to_address(last_), std::forward<Args>(args)...);
+      Inc(last_);
+      ++size_;
+      stats_.OnPush(1, Size());
+    } else if (action != EOverflowAction::kDrop && !Empty()) {
+      Overwrite(last_, std::forward<Args>(args)...);
+      Inc(last_);
+      first_ = last_;
+      stats_.OnOverwrite(1);
+      stats_.OnPush(1, Size());
+    } else {
+      stats_.OnDrop(1);
+    }
+  }
+
+  template<typename... Args>
+  void OverflowFront(EOverflowAction action, Args&& ... args) {
+    if (action != EOverflowAction::kDrop && !Full()) {
+      Dec(first_);
+      alloc_traits::construct(allocator_, std::to_address(first_), std::forward<Args>(args)...);
+      ++size_;
+      stats_.OnPush(1, Size());
+    } else if (action != EOverflowAction::kDrop && !Empty()) {
+      Dec(first_);
+      Overwrite(first_, std::forward<Args>(args)...);
+      last_ = first_;
+      stats_.OnOverwrite(1);
+      stats_.OnPush(1, Size());
+    } else {
+      stats_.OnDrop(1);
+    }
+  }
+
+  template<typename Generator>
+  iterator InsertN(size_type index, size_type n, Generator next) {
+    if (Size() + n > Capacity() && overflow_.OnOverflow(*this, Size() + n) == EOverflowAction::kDrop) {
+      stats_.OnDrop(n);
+      return IteratorAt(index);
+    }
+    stats_.OnPush(n, std::min(Size() + n, Capacity()));
+    if (Size() + n > Capacity()) {
+      size_type drop = Size() + n - Capacity();
+      stats_.OnOverwrite(drop);
+      size_type drop_front = std::min<size_type>(drop, index);
+      for (size_type i = 0; i < drop_front; ++i)
+        DropFront();
+      index -= drop_front;
+      for (; drop > drop_front; --drop, --n)
+        next();
+    }
+    if (n == 0)
+      return IteratorAt(index);
+
+    size_type tail = Size() - index;
+    if (index < tail) {
+      pointer new_first = Sub(first_, n);
+      pointer src = first_;
+      pointer dest = new_first;
+      size_type raw = std::min(n, index);
+      for (size_type i = 0; i < raw; ++i, Inc(src), Inc(dest))
+        alloc_traits::construct(allocator_, std::to_address(dest), std::move(*src));
+      MoveForward(src, dest, index - raw);
+      dest = Add(dest, index - raw);
+      for (size_type i = raw; i < n; ++i, Inc(dest))
+        alloc_traits::construct(allocator_, std::to_address(dest), next());
+      for (size_type i = 0; i < raw; ++i, Inc(dest))
+        *dest = next();
+      first_ = new_first;
+    } else {
+      pointer new_last = Add(last_, n);
+      pointer src = last_;
+      pointer dest = new_last;
+      size_type raw = std::min(n, tail);
+      for (size_type i = 0; i < raw; ++i) {
+        Dec(src);
+        Dec(dest);
+        alloc_traits::construct(allocator_, std::to_address(dest), std::move(*src));
+      }
+      MoveBackward(src, dest, tail - raw);
+      dest = Add(first_, index);
+      for (size_type i = 0; i < raw; ++i, Inc(dest))
+        *dest = next();
+      for (size_type i = raw; i < n; ++i, Inc(dest))
+        alloc_traits::construct(allocator_, std::to_address(dest), next());
+      last_ = new_last;
+    }
+    size_ += n;
+
+    return IteratorAt(index);
+  }
+
+  void MoveForward(pointer src, pointer dest, size_type n) {
+    while (n > 0) {
+      size_type chunk = std::min<size_type>({n, size_type(end_ - src), size_type(end_ - dest)});
+      std::move(src, src + chunk, dest);
+      n -= chunk;
+      src += chunk;
+      dest += chunk;
+      if (src == end_)
+        src = begin_;
+      if (dest == end_)
+        dest = begin_;
+    }
+  }
+
+  void MoveBackward(pointer src_end, pointer dest_end, size_type n) {
+    while (n > 0) {
+      if (src_end == begin_)
+        src_end = end_;
+      if (dest_end == begin_)
+        dest_end = end_;
+      size_type chunk = std::min<size_type>({n, size_type(src_end - begin_), size_type(dest_end - begin_)});
+      std::move_backward(src_end - chunk, src_end, dest_end);
+      n -= chunk;
+      src_end -= chunk;
+      dest_end -= chunk;
+    }
+  }
+
+  template<typename... Args>
+  void Overwrite(pointer p, Args&& ... args) {
+    if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, value_type> && ...))
+      *p = (std::forward<Args>(args), ...);
+    else
+      *p = value_type(std::forward<Args>(args)...);
+  }
+
+  void Release() {
+    begin_ = end_ = first_ = last_ = 0;
+    size_ = 0;
+  }
+
+  void DropFront() {
+    alloc_traits::destroy(allocator_, first_);
+    Inc(first_);
+    --size_;
+  }
+
+  void DropFront(size_type n) {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < n; ++i, Inc(first_))
+        alloc_traits::destroy(allocator_, std::to_address(first_));
+    } else {
+      first_ = Add(first_, n);
+    }
+    size_ -= n;
+  }
+
+  void Shrink() {
+    if constexpr (Overflow::kShrinks)
+      overflow_.OnShrink(*this);
+  }
+
   void InitializeBuffer(size_type capacity) {
     begin_ = alloc_traits::allocate(allocator_, capacity);
     end_ = begin_ + capacity;
@@ -369,29 +776,58 @@ class CCircularBuffer {
     return dest;
   }
 
+  pointer Relocate(pointer dest) {
+    if (Empty())
+      return dest;
+    if (first_ < last_)
+      return RelocateSegment(first_, last_, dest);
+    dest = RelocateSegment(first_, end_, dest);
+    return RelocateSegment(begin_, last_, dest);
+  }
+
+  pointer RelocateSegment(pointer first, pointer last, pointer dest) {
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      std::memcpy(std::to_address(dest), std::to_address(first), (last - first) * sizeof(value_type));
+      return dest + (last - first);
+    } else {
+      for (; first != last; ++first, ++dest) {
+        alloc_traits::construct(allocator_, std::to_address(dest), std::move_if_noexcept(*first));
+        alloc_traits::destroy(allocator_, std::to_address(first));
+      }
+      return dest;
+    }
+  }
+
   void Destroy_elements() {
     for (size_type i = 0; i < Size(); ++i, Inc(first_))
       alloc_traits::destroy(allocator_, std::to_address(first_));
   }
 
+  void Deallocate() {
+    if (begin_)
+      alloc_traits::deallocate(allocator_, std::to_address(begin_), Capacity());
+  }
+
   void Destroy() {
     Destroy_elements();
-    alloc_traits::deallocate(allocator_, std::to_address(begin_), Capacity());
+    Deallocate();
   }
 
 };
 
-template<typename T, typename Alloc>
-bool operator==(const CCircularBuffer<T, Alloc>& lhs, const CCircularBuffer<T, Alloc>& rhs) {
+template<typename T, typename Alloc, typename Overflow1, typename Stats1, typename Overflow2, typename Stats2>
+bool operator==(const CCircularBuffer<T, Alloc, Overflow1, Stats1>& lhs,
+                const CCircularBuffer<T, Alloc, Overflow2, Stats2>& rhs) {
   return lhs.Size() == rhs.Size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template<typename T, typename Alloc>
-bool operator!=(const CCircularBuffer<T, Alloc>& lhs, const CCircularBuffer<T, Alloc>& rhs) {
+template<typename T, typename Alloc, typename Overflow1, typename Stats1, typename Overflow2, typename Stats2>
+bool operator!=(const CCircularBuffer<T, Alloc, Overflow1, Stats1>& lhs,
+                const CCircularBuffer<T, Alloc, Overflow2, Stats2>& rhs) {
   return !(lhs == rhs);
 }
 
-template<typename T, typename Alloc>
-void swap(CCircularBuffer<T, Alloc>& lhs, CCircularBuffer<T, Alloc>& rhs) {
+template<typename T, typename Alloc, typename Overflow, typename Stats>
+void swap(CCircularBuffer<T, Alloc, Overflow, Stats>& lhs, CCircularBuffer<T, Alloc, Overflow, Stats>& rhs) {
   lhs.swap(rhs);
 }
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+enum class EOverflowAction {
+  kOverwrite,
+  kDrop,
+  kInsert
+};
+
+struct COverwriteOverflow {
+  static constexpr bool kReallocates = false;
+  static constexpr bool kShrinks = false;
+
+  template<typename Buffer>
+  EOverflowAction OnOverflow(Buffer&, size_t) const {
+    return EOverflowAction::kOverwrite;
+  }
+};
+
+struct CRejectOverflow {
+  static constexpr bool kReallocates = false;
+  static constexpr bool kShrinks = false;
+
+  template<typename Buffer>
+  EOverflowAction OnOverflow(Buffer&, size_t) const {
+    return EOverflowAction::kDrop;
+  }
+};
+
+template<size_t GrowthPercent = 200, size_t MaxCapacity = SIZE_MAX>
+struct CBasicGrowOverflow {
+  static_assert(GrowthPercent > 100, "growth factor must exceed 1");
+
+  static constexpr bool kReallocates = true;
+  static constexpr bool kShrinks = false;
+
+  template<typename Buffer>
+  EOverflowAction OnOverflow(Buffer& buffer, size_t required) const {
+    size_t capacity = buffer.Capacity();
+    if (capacity >= MaxCapacity)
+      return EOverflowAction::kOverwrite;
+    size_t grown = capacity > SIZE_MAX / GrowthPercent ? SIZE_MAX : capacity * GrowthPercent / 100;
+    buffer.Reserve(std::min(std::max({required, grown, capacity + 1}), MaxCapacity));
+    return required > MaxCapacity ? EOverflowAction::kOverwrite : EOverflowAction::kInsert;
+  }
+};
+
+typedef CBasicGrowOverflow<> CGrowOverflow;
+
+template<size_t ShrinkDivisor = 4, size_t MinCapacity = 16, size_t GrowthPercent = 200, size_t MaxCapacity = SIZE_MAX>
+struct CGrowShrinkOverflow : CBasicGrowOverflow<GrowthPercent, MaxCapacity> {
+  static_assert(ShrinkDivisor > 2, "halving at this fill ratio would refill the buffer and thrash");
+
+  static constexpr bool kShrinks = true;
+
+  template<typename Buffer>
+  void OnShrink(Buffer& buffer) const {
+    if (buffer.Capacity() > MinCapacity && buffer.Size() * ShrinkDivisor < buffer.Capacity())
+      buffer.Reserve(std::max({buffer.Capacity() / 2, buffer.Size(), MinCapacity}));
+  }
+};
+
+template<typename Callback>
+struct CCallbackOverflow {
+  static constexpr bool kReallocates = true;
+  static constexpr bool kShrinks = false;
+
+  Callback callback;
+
+  template<typename Buffer>
+  EOverflowAction OnOverflow(Buffer& buffer, size_t required) {
+    return callback(buffer, required);
+  }
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+struct CCircularBufferStatsSnapshot {
+  size_t pushes = 0;
+  size_t pops = 0;
+  size_t overwrites = 0;
+  size_t drops = 0;
+  size_t grows = 0;
+  size_t shrinks = 0;
+  size_t reallocated_bytes = 0;
+  size_t high_water_mark = 0;
+
+  std::string ToText() const {
+    return "pushes=" + std::to_string(pushes) + " pops=" + std::to_string(pops) + " overwrites="
+        + std::to_string(overwrites) + " drops=" + std::to_string(drops) + " grows=" + std::to_string(grows)
+        + " shrinks=" + std::to_string(shrinks) + " reallocated_bytes=" + std::to_string(reallocated_bytes)
+        + " high_water_mark=" + std::to_string(high_water_mark);
+  }
+
+  std::string ToJson() const {
+    return "{\"pushes\":" + std::to_string(pushes) + ",\"pops\":" + std::to_string(pops) + ",\"overwrites\":"
+        + std::to_string(overwrites) + ",\"drops\":" + std::to_string(drops) + ",\"grows\":" + std::to_string(grows)
+        + ",\"shrinks\":" + std::to_string(shrinks) + ",\"reallocated_bytes\":" + std::to_string(reallocated_bytes)
+        + ",\"high_water_mark\":" + std::to_string(high_water_mark) + "}";
+  }
+};
+
+struct CNullStats {
+  void OnPush(size_t, size_t) {}
+
+  void OnPop(size_t) {}
+
+  void OnOverwrite(size_t) {}
+
+  void OnDrop(size_t) {}
+
+  void OnReallocate(size_t, size_t, size_t) {}
+
+  CCircularBufferStatsSnapshot Snapshot() const {
+    return {};
+  }
+};
+
+struct CCountingStats {
+  CCircularBufferStatsSnapshot counters;
+
+  void OnPush(size_t n, size_t size) {
+    counters.pushes += n;
+    counters.high_water_mark = std::max(counters.high_water_mark, size);
+  }
+
+  void OnPop(size_t n) {
+    counters.pops += n;
+  }
+
+  void OnOverwrite(size_t n) {
+    counters.overwrites += n;
+  }
+
+  void OnDrop(size_t n) {
+    counters.drops += n;
+  }
+
+  void OnReallocate(size_t old_capacity, size_t new_capacity, size_t element_size) {
+    if (new_capacity > old_capacity)
+      ++counters.grows;
+    else
+      ++counters.shrinks;
+    counters.reallocated_bytes += new_capacity * element_size;
+  }
+
+  CCircularBufferStatsSnapshot Snapshot() const {
+    return counters;
+  }
+
+  void Reset() {
+    counters = {};
+  }
+};
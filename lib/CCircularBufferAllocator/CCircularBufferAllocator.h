@@ -0,0 +1,250 @@
+#pragma once
+
+#include "../CCircularBuffer/CCircularBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+class CPoolResource final : public std::pmr::memory_resource {
+ public:
+  typedef size_t size_type;
+
+  static constexpr size_type kMinBlockSize = 16;
+  static constexpr size_type kMaxBlockSize = size_type(1) << 16;
+  static constexpr size_type kChunkSize = size_type(1) << 16;
+
+ private:
+  static constexpr size_type kClassCount = std::bit_width(kMaxBlockSize / kMinBlockSize);
+
+  struct Block {
+    Block* next;
+  };
+
+  struct alignas(std::max_align_t) Chunk {
+    Chunk* next;
+    size_type bytes;
+  };
+
+  std::array<Block*, kClassCount> free_;
+  Chunk* chunks_;
+  std::pmr::memory_resource* upstream_;
+
+ public:
+  explicit CPoolResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : free_(), chunks_(0), upstream_(upstream) {}
+
+  CPoolResource(const CPoolResource&) = delete;
+
+  CPoolResource& operator=(const CPoolResource&) = delete;
+
+  ~CPoolResource() override {
+    Release();
+  }
+
+  std::pmr::memory_resource* UpstreamResource() const {
+    return upstream_;
+  }
+
+  static constexpr size_type BlockSize(size_type bytes) {
+    return std::bit_ceil(std::max(bytes, kMinBlockSize));
+  }
+
+  void Release() {
+    while (chunks_) {
+      Chunk* next = chunks_->next;
+      upstream_->deallocate(chunks_, chunks_->bytes, alignof(Chunk));
+      chunks_ = next;
+    }
+    free_.fill(0);
+  }
+
+ private:
+  static size_type ClassIndex(size_type bytes) {
+    return std::bit_width(BlockSize(bytes) / kMinBlockSize) - 1;
+  }
+
+  static bool Pooled(size_type bytes, size_type alignment) {
+    return bytes <= kMaxBlockSize && alignment <= alignof(std::max_align_t);
+  }
+
+  // Kept out of line: once devirtualized and inlined into a container, the pool
+  // paths stop it from keeping its pointers in registers.
+  [[gnu::noinline]] void* do_allocate(size_type bytes, size_type alignment) override {
+    if (!Pooled(bytes, alignment))
+      return upstream_->allocate(bytes, alignment);
+    Block*& head = free_[ClassIndex(bytes)];
+    if (!head)
+      Refill(head, BlockSize(bytes));
+    Block* block = head;
+    head = block->next;
+
+    return block;
+  }
+
+  [[gnu::noinline]] void do_deallocate(void* p, size_type bytes, size_type alignment) override {
+    if (!p)
+      return;
+    if (!Pooled(bytes, alignment)) {
+      upstream_->deallocate(p, bytes, alignment);
+      return;
+    }
+    Block*& head = free_[ClassIndex(bytes)];
+    head = ::new(p) Block{head};
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  void Refill(Block*& head, size_type block_size) {
+    size_type count = std::max<size_type>(1, kChunkSize / block_size);
+    size_type bytes = sizeof(Chunk) + count * block_size;
+    chunks_ = ::new(upstream_->allocate(bytes, alignof(Chunk))) Chunk{chunks_, bytes};
+    std::byte* blocks = reinterpret_cast<std::byte*>(chunks_ + 1);
+    for (size_type i = count; i > 0; --i)
+      head = ::new(blocks + (i - 1) * block_size) Block{head};
+  }
+
+};
+
+class CArenaResource final : public std::pmr::memory_resource {
+ public:
+  typedef size_t size_type;
+
+  static constexpr size_type kInitialBlockSize = 4096;
+
+ private:
+  struct alignas(std::max_align_t) Chunk {
+    Chunk* next;
+    size_type bytes;
+  };
+
+  std::byte* initial_;
+  size_type initial_size_;
+  std::byte* current_;
+  size_type available_;
+  size_type next_size_;
+  Chunk* chunks_;
+  std::pmr::memory_resource* upstream_;
+
+ public:
+  explicit CArenaResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : CArenaResource(0, 0, upstream) {}
+
+  CArenaResource(void* buffer, size_type size,
+                 std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : initial_(static_cast<std::byte*>(buffer)), initial_size_(size), current_(initial_), available_(size),
+        next_size_(std::max(size, kInitialBlockSize)), chunks_(0), upstream_(upstream) {}
+
+  CArenaResource(const CArenaResource&) = delete;
+
+  CArenaResource& operator=(const CArenaResource&) = delete;
+
+  ~CArenaResource() override {
+    Release();
+  }
+
+  std::pmr::memory_resource* UpstreamResource() const {
+    return upstream_;
+  }
+
+  void Release() {
+    while (chunks_) {
+      Chunk* next = chunks_->next;
+      upstream_->deallocate(chunks_, chunks_->bytes, alignof(Chunk));
+      chunks_ = next;
+    }
+    current_ = initial_;
+    available_ = initial_size_;
+    next_size_ = std::max(initial_size_, kInitialBlockSize);
+  }
+
+ private:
+  [[gnu::noinline]] void* do_allocate(size_type bytes, size_type alignment) override {
+    bytes = std::max<size_type>(bytes, 1);
+    void* p = current_;
+    if (!std::align(alignment, bytes, p, available_)) {
+      Grow(bytes + alignment);
+      p = current_;
+      std::align(alignment, bytes, p, available_);
+    }
+    current_ = static_cast<std::byte*>(p) + bytes;
+    available_ -= bytes;
+
+    return p;
+  }
+
+  void do_deallocate(void*, size_type, size_type) override {}
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  void Grow(size_type min_bytes) {
+    size_type bytes = sizeof(Chunk) + std::max(next_size_, min_bytes);
+    chunks_ = ::new(upstream_->allocate(bytes, alignof(Chunk))) Chunk{chunks_, bytes};
+    current_ = reinterpret_cast<std::byte*>(chunks_ + 1);
+    available_ = bytes - sizeof(Chunk);
+    next_size_ *= 2;
+  }
+
+};
+
+template<typename T, typename Resource>
+class CResourceAllocator {
+ public:
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+  typedef std::false_type is_always_equal;
+
+ private:
+  Resource* resource_;
+  template<typename U, typename R> friend
+  class CResourceAllocator;
+
+ public:
+  CResourceAllocator(Resource* resource) noexcept: resource_(resource) {}
+
+  template<typename U>
+  CResourceAllocator(const CResourceAllocator<U, Resource>& other) noexcept : resource_(other.resource_) {}
+
+  Resource* GetResource() const {
+    return resource_;
+  }
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, size_t n) {
+    if (p == nullptr)
+      return;
+    resource_->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  template<typename U>
+  bool operator==(const CResourceAllocator<U, Resource>& other) const {
+    return resource_ == other.resource_;
+  }
+
+  template<typename U>
+  bool operator!=(const CResourceAllocator<U, Resource>& other) const {
+    return resource_ != other.resource_;
+  }
+
+};
+
+template<typename T>
+using CPoolAllocator = CResourceAllocator<T, CPoolResource>;
+
+template<typename T>
+using CArenaAllocator = CResourceAllocator<T, CArenaResource>;
+
+template<typename T, typename Overflow = COverwriteOverflow>
+using CPmrCircularBuffer = CCircularBuffer<T, std::pmr::polymorphic_allocator<T>, Overflow>;
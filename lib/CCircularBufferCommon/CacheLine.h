@@ -0,0 +1,5 @@
+#pragma once
+
+#include <cstddef>
+
+inline constexpr size_t kCacheLineSize = 64;
@@ -28,6 +28,7 @@ class CCircularBufferIter {
  public:
   typedef CCircularBufferIter<Container, typename Traits::nonconst_self> nonconst_self;
   typedef std::random_access_iterator_tag iterator_category;
+  typedef std::random_access_iterator_tag iterator_concept;
   typedef typename Traits::value_type value_type;
   typedef typename Traits::difference_type difference_type;
   typedef typename Traits::reference reference;
@@ -35,136 +36,108 @@ class CCircularBufferIter {
   typedef typename Traits::size_type size_type;
 
   const Container* buff_;
-  pointer iter_;
+  size_type index_;
 
  public:
-  CCircularBufferIter(const Container* cb, const pointer iter) : buff_(cb), iter_(iter) {}
+  constexpr CCircularBufferIter(const Container* cb, size_type index) : buff_(cb), index_(index) {}
 
-  CCircularBufferIter() : buff_(0), iter_(0) {}
+  constexpr CCircularBufferIter() : buff_(0), index_(0) {}
 
-  CCircularBufferIter(const nonconst_self& it) : buff_(it.buff_), iter_(it.iter_) {}
+  constexpr CCircularBufferIter(const nonconst_self& it) : buff_(it.buff_), index_(it.index_) {}
 
-  CCircularBufferIter& operator=(const CCircularBufferIter& it) {
-    if (this == &it)
-      return *this;
-    buff_ = it.buff_;
-    iter_ = it.iter_;
+  constexpr CCircularBufferIter& operator=(const CCircularBufferIter& it) = default;
 
-    return *this;
-  }
-
-  reference operator*() const {
-    return *iter_;
+  constexpr reference operator*() const {
+    return *buff_->At(index_);
   }
 
-  pointer operator->() const {
-    return &(operator*());
+  constexpr pointer operator->() const {
+    return buff_->At(index_);
   }
 
   template<typename Traits0>
-  difference_type operator-(const CCircularBufferIter<Container, Traits0>& it) const {
-    return LinearizePointer(*this) - LinearizePointer(it);
+  constexpr difference_type operator-(const CCircularBufferIter<Container, Traits0>& it) const {
+    return difference_type(index_ - it.index_);
   }
 
-  CCircularBufferIter& operator++() {
-    buff_->Inc(iter_);
-    if (iter_ == buff_->last_)
-      iter_ = 0;
-
+  constexpr CCircularBufferIter& operator++() {
+    ++index_;
     return *this;
   }
 
-  CCircularBufferIter operator++(int) {
-    CCircularBufferIter<Container, Traits> tmp = *this;
-    ++*this;
+  constexpr CCircularBufferIter operator++(int) {
+    CCircularBufferIter tmp = *this;
+    ++index_;
 
     return tmp;
   }
 
-  CCircularBufferIter& operator--() {
-    if (iter_ == 0)
-      iter_ = buff_->last_;
-    buff_->Dec(iter_);
-
+  constexpr CCircularBufferIter& operator--() {
+    --index_;
     return *this;
   }
 
-  CCircularBufferIter operator--(int) {
-    CCircularBufferIter<Container, Traits> tmp = *this;
-    --*this;
+  constexpr CCircularBufferIter operator--(int) {
+    CCircularBufferIter tmp = *this;
+    --index_;
 
     return tmp;
   }
 
-  CCircularBufferIter& operator+=(difference_type n) {
-    if (n > 0) {
-      iter_ = buff_->Add(iter_, n);
-      if (iter_ == buff_->last_)
-        iter_ = 0;
-    } else if (n < 0) {
-      *this -= -n;
-    }
-
+  constexpr CCircularBufferIter& operator+=(difference_type n) {
+    index_ += n;
     return *this;
   }
 
-  CCircularBufferIter operator+(difference_type n) const {
-    return CCircularBufferIter<Container, Traits>(*this) += n;
+  constexpr CCircularBufferIter operator+(difference_type n) const {
+    return CCircularBufferIter(*this) += n;
   }
 
-  CCircularBufferIter& operator-=(difference_type n) {
-    if (n > 0) {
-      iter_ = buff_->Sub(iter_ == 0 ? buff_->last_ : iter_, n);
-    } else if (n < 0) {
-      *this += -n;
-    }
+  friend constexpr CCircularBufferIter operator+(difference_type n, const CCircularBufferIter& it) {
+    return it + n;
+  }
 
+  constexpr CCircularBufferIter& operator-=(difference_type n) {
+    index_ -= n;
     return *this;
   }
 
-  CCircularBufferIter operator-(difference_type n) const {
-    return CCircularBufferIter<Container, Traits>(*this) -= n;
+  constexpr CCircularBufferIter operator-(difference_type n) const {
+    return CCircularBufferIter(*this) -= n;
   }
 
-  reference operator[](difference_type n) const {
-    return *(*this + n);
+  constexpr reference operator[](difference_type n) const {
+    return *buff_->At(index_ + n);
   }
 
   template<class Traits0>
-  typename Traits0::pointer LinearizePointer(const CCircularBufferIter<Container, Traits0>& it) const {
-    return it.iter_ == 0 ? buff_->begin_ + buff_->Size() :
-           (it.iter_ < buff_->first_ ? it.iter_ + (buff_->end_ - buff_->first_)
-                                     : buff_->begin_ + (it.iter_ - buff_->first_));
+  constexpr bool operator==(const CCircularBufferIter<Container, Traits0>& it) const {
+    return index_ == it.index_;
   }
 
   template<class Traits0>
-  bool operator==(const CCircularBufferIter<Container, Traits0>& it) const {
-    return iter_ == it.iter_;
+  constexpr bool operator!=(const CCircularBufferIter<Container, Traits0>& it) const {
+    return index_ != it.index_;
   }
 
   template<class Traits0>
-  bool operator!=(const CCircularBufferIter<Container, Traits0>& it) const {
-    return iter_ != it.iter_;
+  constexpr bool operator<(const CCircularBufferIter<Container, Traits0>& it) const {
+    return index_ < it.index_;
   }
 
   template<class Traits0>
-  bool operator<(const CCircularBufferIter<Container, Traits0>& it) const {
-    return LinearizePointer(*this) < LinearizePointer(it);
-  }
-
-  template<class Traits0>
-  bool operator>(const CCircularBufferIter<Container, Traits0>& it) const {
+  constexpr bool operator>(const CCircularBufferIter<Container, Traits0>& it) const {
     return it < *this;
   }
 
   template<class Traits0>
-  bool operator<=(const CCircularBufferIter<Container, Traits0>& it) const {
+  constexpr bool operator<=(const CCircularBufferIter<Container, Traits0>& it) const {
     return !(it < *this);
   }
 
   template<class Traits0>
-  bool operator>=(const CCircularBufferIter<Container, Traits0>& it) const {
+  constexpr bool operator>=(const CCircularBufferIter<Container, Traits0>& it) const {
     return !(*this < it);
   }
 
-};
\ No newline at end of file
+};
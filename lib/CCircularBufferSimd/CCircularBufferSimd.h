@@ -0,0 +1,281 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+enum class ESimdLevel {
+  kScalar,
+  kSse2,
+  kAvx2
+};
+
+inline ESimdLevel DetectSimdLevel() {
+#if defined(__x86_64__) || defined(__i386__)
+  static const ESimdLevel level = __builtin_cpu_supports("avx2") ? ESimdLevel::kAvx2
+                                : __builtin_cpu_supports("sse2") ? ESimdLevel::kSse2 : ESimdLevel::kScalar;
+  return level;
+#else
+  return ESimdLevel::kScalar;
+#endif
+}
+
+template<typename T>
+inline constexpr bool kSimdAggregatable = std::is_same_v<T, float> || std::is_same_v<T, double>
+    || std::is_same_v<T, int64_t>;
+
+template<typename T>
+inline constexpr T kAggregateMinIdentity = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                               : std::numeric_limits<T>::max();
+
+template<typename T>
+inline constexpr T kAggregateMaxIdentity = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                                               : std::numeric_limits<T>::lowest();
+
+template<typename T, size_t Bytes>
+struct CSimdKernel {
+  typedef T vector_type __attribute__((vector_size(Bytes)));
+  typedef decltype(vector_type{} > vector_type{}) mask_type;
+
+  static constexpr size_t kLanes = Bytes / sizeof(T);
+
+  [[gnu::always_inline]] static inline void Load(vector_type& v, const T* p) {
+    std::memcpy(&v, p, Bytes);
+  }
+
+  [[gnu::always_inline]] static inline void Broadcast(vector_type& v, T value) {
+    for (size_t i = 0; i < kLanes; ++i)
+      v[i] = value;
+  }
+
+  [[gnu::always_inline]] static inline T Sum(const T* p, size_t n) {
+    vector_type acc0 = {};
+    vector_type acc1 = {};
+    vector_type v0;
+    vector_type v1;
+    size_t i = 0;
+    for (; i + 2 * kLanes <= n; i += 2 * kLanes) {
+      Load(v0, p + i);
+      Load(v1, p + i + kLanes);
+      acc0 += v0;
+      acc1 += v1;
+    }
+    for (; i + kLanes <= n; i += kLanes) {
+      Load(v0, p + i);
+      acc0 += v0;
+    }
+    acc0 += acc1;
+
+    T sum = 0;
+    for (size_t lane = 0; lane < kLanes; ++lane)
+      sum += acc0[lane];
+    for (; i < n; ++i)
+      sum += p[i];
+    return sum;
+  }
+
+  [[gnu::always_inline]] static inline T Min(const T* p, size_t n) {
+    vector_type acc;
+    vector_type v;
+    Broadcast(acc, kAggregateMinIdentity<T>);
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      Load(v, p + i);
+      acc = v < acc ? v : acc;
+    }
+
+    T min = kAggregateMinIdentity<T>;
+    for (size_t lane = 0; lane < kLanes; ++lane)
+      min = acc[lane] < min ? acc[lane] : min;
+    for (; i < n; ++i)
+      min = p[i] < min ? p[i] : min;
+    return min;
+  }
+
+  [[gnu::always_inline]] static inline T Max(const T* p, size_t n) {
+    vector_type acc;
+    vector_type v;
+    Broadcast(acc, kAggregateMaxIdentity<T>);
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      Load(v, p + i);
+      acc = v > acc ? v : acc;
+    }
+
+    T max = kAggregateMaxIdentity<T>;
+    for (size_t lane = 0; lane < kLanes; ++lane)
+      max = acc[lane] > max ? acc[lane] : max;
+    for (; i < n; ++i)
+      max = p[i] > max ? p[i] : max;
+    return max;
+  }
+
+  [[gnu::always_inline]] static inline size_t CountAbove(const T* p, size_t n, T threshold) {
+    vector_type limit;
+    vector_type v;
+    Broadcast(limit, threshold);
+    mask_type acc = {};
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      Load(v, p + i);
+      acc -= v > limit;
+    }
+
+    size_t count = 0;
+    for (size_t lane = 0; lane < kLanes; ++lane)
+      count += acc[lane];
+    for (; i < n; ++i)
+      count += p[i] > threshold;
+    return count;
+  }
+};
+
+template<typename T>
+struct CScalarKernel {
+  static T Sum(const T* p, size_t n) {
+    T sum = 0;
+    for (size_t i = 0; i < n; ++i)
+      sum += p[i];
+    return sum;
+  }
+
+  static T Min(const T* p, size_t n) {
+    T min = kAggregateMinIdentity<T>;
+    for (size_t i = 0; i < n; ++i)
+      min = p[i] < min ? p[i] : min;
+    return min;
+  }
+
+  static T Max(const T* p, size_t n) {
+    T max = kAggregateMaxIdentity<T>;
+    for (size_t i = 0; i < n; ++i)
+      max = p[i] > max ? p[i] : max;
+    return max;
+  }
+
+  static size_t CountAbove(const T* p, size_t n, T threshold) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; ++i)
+      count += p[i] > threshold;
+    return count;
+  }
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+template<typename T, size_t Bytes>
+struct CTargetKernel;
+
+template<typename T>
+struct CTargetKernel<T, 32> {
+  __attribute__((target("avx2"))) static T Sum(const T* p, size_t n) {
+    return CSimdKernel<T, 32>::Sum(p, n);
+  }
+
+  __attribute__((target("avx2"))) static T Min(const T* p, size_t n) {
+    return CSimdKernel<T, 32>::Min(p, n);
+  }
+
+  __attribute__((target("avx2"))) static T Max(const T* p, size_t n) {
+    return CSimdKernel<T, 32>::Max(p, n);
+  }
+
+  __attribute__((target("avx2"))) static size_t CountAbove(const T* p, size_t n, T threshold) {
+    return CSimdKernel<T, 32>::CountAbove(p, n, threshold);
+  }
+};
+
+template<typename T>
+struct CTargetKernel<T, 16> {
+  __attribute__((target("sse2"))) static T Sum(const T* p, size_t n) {
+    return CSimdKernel<T, 16>::Sum(p, n);
+  }
+
+  __attribute__((target("sse2"))) static T Min(const T* p, size_t n) {
+    return CSimdKernel<T, 16>::Min(p, n);
+  }
+
+  __attribute__((target("sse2"))) static T Max(const T* p, size_t n) {
+    return CSimdKernel<T, 16>::Max(p, n);
+  }
+
+  __attribute__((target("sse2"))) static size_t CountAbove(const T* p, size_t n, T threshold) {
+    return CSimdKernel<T, 16>::CountAbove(p, n, threshold);
+  }
+};
+#define C_CIRCULAR_BUFFER_SIMD_SELECT(level, call)                                        \
+  switch (level) {                                                                        \
+    case ESimdLevel::kAvx2:                                                               \
+      return CTargetKernel<T, 32>::call;                                                  \
+    case ESimdLevel::kSse2:                                                               \
+      return CTargetKernel<T, 16>::call;                                                  \
+    default:                                                                              \
+      return CScalarKernel<T>::call;                                                      \
+  }
+#else
+#define C_CIRCULAR_BUFFER_SIMD_SELECT(level, call) return CScalarKernel<T>::call;
+#endif
+
+template<typename T>
+T SpanSum(std::span<const T> items, ESimdLevel level = DetectSimdLevel()) {
+  static_assert(kSimdAggregatable<T>);
+  C_CIRCULAR_BUFFER_SIMD_SELECT(level, Sum(items.data(), items.size()))
+}
+
+template<typename T>
+T SpanMin(std::span<const T> items, ESimdLevel level = DetectSimdLevel()) {
+  static_assert(kSimdAggregatable<T>);
+  C_CIRCULAR_BUFFER_SIMD_SELECT(level, Min(items.data(), items.size()))
+}
+
+template<typename T>
+T SpanMax(std::span<const T> items, ESimdLevel level = DetectSimdLevel()) {
+  static_assert(kSimdAggregatable<T>);
+  C_CIRCULAR_BUFFER_SIMD_SELECT(level, Max(items.data(), items.size()))
+}
+
+template<typename T>
+size_t SpanCountAbove(std::span<const T> items, T threshold, ESimdLevel level = DetectSimdLevel()) {
+  static_assert(kSimdAggregatable<T>);
+  C_CIRCULAR_BUFFER_SIMD_SELECT(level, CountAbove(items.data(), items.size(), threshold))
+}
+
+#undef C_CIRCULAR_BUFFER_SIMD_SELECT
+
+template<typename Buffer>
+typename Buffer::value_type AggregateSum(const Buffer& buffer, ESimdLevel level = DetectSimdLevel()) {
+  typedef typename Buffer::value_type value_type;
+  return SpanSum<value_type>(buffer.ArrayOne(), level) + SpanSum<value_type>(buffer.ArrayTwo(), level);
+}
+
+template<typename Buffer>
+typename Buffer::value_type AggregateMin(const Buffer& buffer, ESimdLevel level = DetectSimdLevel()) {
+  typedef typename Buffer::value_type value_type;
+  value_type one = SpanMin<value_type>(buffer.ArrayOne(), level);
+  value_type two = SpanMin<value_type>(buffer.ArrayTwo(), level);
+  return two < one ? two : one;
+}
+
+template<typename Buffer>
+typename Buffer::value_type AggregateMax(const Buffer& buffer, ESimdLevel level = DetectSimdLevel()) {
+  typedef typename Buffer::value_type value_type;
+  value_type one = SpanMax<value_type>(buffer.ArrayOne(), level);
+  value_type two = SpanMax<value_type>(buffer.ArrayTwo(), level);
+  return two > one ? two : one;
+}
+
+template<typename Buffer>
+double AggregateMean(const Buffer& buffer, ESimdLevel level = DetectSimdLevel()) {
+  if (buffer.Empty())
+    return 0;
+  return double(AggregateSum(buffer, level)) / double(buffer.Size());
+}
+
+template<typename Buffer>
+size_t AggregateCountAbove(const Buffer& buffer, typename Buffer::value_type threshold,
+                           ESimdLevel level = DetectSimdLevel()) {
+  typedef typename Buffer::value_type value_type;
+  return SpanCountAbove<value_type>(buffer.ArrayOne(), threshold, level)
+      + SpanCountAbove<value_type>(buffer.ArrayTwo(), threshold, level);
+}
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <initializer_list>
+#include <numeric>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+template<typename T>
+class CMirroredCircularBuffer {
+  static_assert(std::is_trivially_copyable_v<T>, "CMirroredCircularBuffer stores trivially copyable values only");
+
+ public:
+  typedef T value_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef const value_type* const_pointer;
+  typedef pointer iterator;
+  typedef const_pointer const_iterator;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+ protected:
+  pointer buffer_;
+  size_type capacity_;
+  size_type first_;
+  size_type size_;
+
+  pointer At(size_type index) const {
+    return buffer_ + first_ + index;
+  }
+
+ public:
+  iterator begin() {
+    return At(0);
+  }
+
+  const_iterator begin() const {
+    return At(0);
+  }
+
+  iterator end() {
+    return At(size_);
+  }
+
+  const_iterator end() const {
+    return At(size_);
+  }
+
+  const_iterator cbegin() const {
+    return begin();
+  }
+
+  const_iterator cend() const {
+    return end();
+  }
+
+  size_type Size() const {
+    return size_;
+  }
+
+  size_type Capacity() const {
+    return capacity_;
+  }
+
+  bool Empty() const {
+    return size_ == 0;
+  }
+
+  bool Full() const {
+    return size_ == capacity_;
+  }
+
+  pointer Data() {
+    return At(0);
+  }
+
+  const_pointer Data() const {
+    return At(0);
+  }
+
+  std::span<value_type> Span() {
+    return {At(0), size_};
+  }
+
+  std::span<const value_type> Span() const {
+    return {At(0), size_};
+  }
+
+  std::span<value_type> FreeSpan() {
+    return {At(size_), capacity_ - size_};
+  }
+
+  reference operator[](size_type index) {
+    return *At(index);
+  }
+
+  const_reference operator[](size_type index) const {
+    return *At(index);
+  }
+
+  reference Front() {
+    return *At(0);
+  }
+
+  const_reference Front() const {
+    return *At(0);
+  }
+
+  reference Back() {
+    return *At(size_ - 1);
+  }
+
+  const_reference Back() const {
+    return *At(size_ - 1);
+  }
+
+  CMirroredCircularBuffer() : buffer_(0), capacity_(0), first_(0), size_(0) {}
+
+  explicit CMirroredCircularBuffer(size_type capacity) : buffer_(0), capacity_(0), first_(0), size_(0) {
+    InitializeBuffer(capacity);
+  }
+
+  CMirroredCircularBuffer(const CMirroredCircularBuffer<T>& other) : buffer_(0), capacity_(0), first_(0), size_(0) {
+    InitializeBuffer(other.capacity_);
+    PushBack(other.Span());
+  }
+
+  CMirroredCircularBuffer(CMirroredCircularBuffer<T>&& other) noexcept
+      : buffer_(other.buffer_), capacity_(other.capacity_), first_(other.first_), size_(other.size_) {
+    other.buffer_ = 0;
+    other.capacity_ = other.first_ = other.size_ = 0;
+  }
+
+  CMirroredCircularBuffer(const std::initializer_list<value_type>& il)
+      : buffer_(0), capacity_(0), first_(0), size_(0) {
+    InitializeBuffer(il.size());
+    PushBack(std::span<const value_type>(il.begin(), il.size()));
+  }
+
+  CMirroredCircularBuffer<T>& operator=(const CMirroredCircularBuffer<T>& other) {
+    if (this == &other)
+      return *this;
+    CMirroredCircularBuffer copy(other);
+    swap(copy);
+
+    return *this;
+  }
+
+  CMirroredCircularBuffer<T>& operator=(CMirroredCircularBuffer<T>&& other) noexcept {
+    if (this == &other)
+      return *this;
+    CMirroredCircularBuffer moved(std::move(other));
+    swap(moved);
+
+    return *this;
+  }
+
+  void PushBack(const value_type& item) {
+    if (capacity_ == 0)
+      return;
+    *At(size_) = item;
+    if (Full())
+      Advance(1);
+    else
+      ++size_;
+  }
+
+  void PushBack(std::span<const value_type> items) {
+    if (capacity_ == 0 || items.empty())
+      return;
+    if (items.size() > capacity_)
+      items = items.last(capacity_);
+    size_type tail = first_ + size_;
+    std::memcpy(buffer_ + (tail >= capacity_ ? tail - capacity_ : tail), items.data(), items.size_bytes());
+    size_type overflow = size_ + items.size() > capacity_ ? size_ + items.size() - capacity_ : 0;
+    size_ += items.size() - overflow;
+    Advance(overflow);
+  }
+
+  void PushFront(const value_type& item) {
+    if (capacity_ == 0)
+      return;
+    first_ = first_ == 0 ? capacity_ - 1 : first_ - 1;
+    *At(0) = item;
+    if (!Full())
+      ++size_;
+  }
+
+  void Commit(size_type n) {
+    size_ += n;
+  }
+
+  void PopBack() {
+    --size_;
+  }
+
+  void PopFront() {
+    Advance(1);
+    --size_;
+  }
+
+  void PopFront(size_type n) {
+    Advance(n);
+    size_ -= n;
+  }
+
+  size_type ReadInto(std::span<value_type> out) {
+    size_type n = std::min(out.size(), size_);
+    if (n == 0)
+      return 0;
+    std::memcpy(out.data(), At(0), n * sizeof(value_type));
+    PopFront(n);
+
+    return n;
+  }
+
+  value_type ExtractBack() {
+    value_type item = Back();
+    PopBack();
+
+    return item;
+  }
+
+  value_type ExtractFront() {
+    value_type item = Front();
+    PopFront();
+
+    return item;
+  }
+
+  void swap(CMirroredCircularBuffer<T>& cb) {
+    std::swap(buffer_, cb.buffer_);
+    std::swap(capacity_, cb.capacity_);
+    std::swap(first_, cb.first_);
+    std::swap(size_, cb.size_);
+  }
+
+  void Clear() {
+    first_ = size_ = 0;
+  }
+
+  ~CMirroredCircularBuffer() {
+    if (buffer_)
+      munmap(buffer_, 2 * capacity_ * sizeof(value_type));
+  }
+
+ private:
+  void Advance(size_type n) {
+    first_ += n;
+    if (first_ >= capacity_)
+      first_ -= capacity_;
+  }
+
+  void InitializeBuffer(size_type capacity) {
+    if (capacity == 0)
+      return;
+    size_type granularity = std::lcm(size_type(sysconf(_SC_PAGESIZE)), sizeof(value_type));
+    size_type bytes = (capacity * sizeof(value_type) + granularity - 1) / granularity * granularity;
+
+    int fd = memfd_create("CMirroredCircularBuffer", MFD_CLOEXEC);
+    if (fd == -1)
+      throw std::system_error(errno, std::system_category(), "memfd_create");
+    void* base = MAP_FAILED;
+    if (ftruncate(fd, bytes) == 0)
+      base = mmap(nullptr, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base != MAP_FAILED) {
+      char* lower = static_cast<char*>(base);
+      if (mmap(lower, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+          || mmap(lower + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, 2 * bytes);
+        base = MAP_FAILED;
+      }
+    }
+    int error = errno;
+    close(fd);
+    if (base == MAP_FAILED)
+      throw std::system_error(error, std::system_category(), "mmap");
+
+    buffer_ = static_cast<pointer>(base);
+    capacity_ = bytes / sizeof(value_type);
+  }
+
+};
+
+template<typename T>
+bool operator==(const CMirroredCircularBuffer<T>& lhs, const CMirroredCircularBuffer<T>& rhs) {
+  return lhs.Size() == rhs.Size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T>
+bool operator!=(const CMirroredCircularBuffer<T>& lhs, const CMirroredCircularBuffer<T>& rhs) {
+  return !(lhs == rhs);
+}
+
+template<typename T>
+void swap(CMirroredCircularBuffer<T>& lhs, CMirroredCircularBuffer<T>& rhs) {
+  lhs.swap(rhs);
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "../CCircularBufferCommon/CacheLine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <thread>
+#include <utility>
+
+enum class EBackPressure {
+  kFail,
+  kSpin,
+  kOverwrite
+};
+
+template<typename T, typename Alloc = std::allocator<T>>
+class CMpmcCircularBuffer {
+ public:
+  typedef typename Alloc::value_type value_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef Alloc allocator_type;
+  typedef size_t size_type;
+
+ protected:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    pointer Data() {
+      return reinterpret_cast<pointer>(storage);
+    }
+  };
+
+  typedef __gnu_cxx::__alloc_traits<allocator_type> alloc_traits;
+  typedef typename alloc_traits::template rebind<Cell>::other cell_allocator_type;
+  typedef __gnu_cxx::__alloc_traits<cell_allocator_type> cell_alloc_traits;
+
+  Cell* cells_;
+  size_type mask_;
+  EBackPressure back_pressure_;
+  Alloc allocator_;
+  cell_allocator_type cell_allocator_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_;
+
+ public:
+  explicit CMpmcCircularBuffer(size_type capacity, EBackPressure back_pressure = EBackPressure::kFail,
+                               const allocator_type& alloc = allocator_type())
+      : mask_(std::bit_ceil(std::max<size_type>(capacity, 2)) - 1), back_pressure_(back_pressure),
+        allocator_(alloc), cell_allocator_(alloc), enqueue_pos_(0), dequeue_pos_(0) {
+    cells_ = cell_alloc_traits::allocate(cell_allocator_, Capacity());
+    for (size_type i = 0; i < Capacity(); ++i)
+      ::new(static_cast<void*>(cells_ + i)) Cell{{i}, {}};
+  }
+
+  CMpmcCircularBuffer(const CMpmcCircularBuffer&) = delete;
+
+  CMpmcCircularBuffer& operator=(const CMpmcCircularBuffer&) = delete;
+
+  ~CMpmcCircularBuffer() {
+    size_type head = dequeue_pos_.load(std::memory_order_relaxed);
+    size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head)
+      alloc_traits::destroy(allocator_, cells_[head & mask_].Data());
+    for (size_type i = 0; i < Capacity(); ++i)
+      cells_[i].~Cell();
+    cell_alloc_traits::deallocate(cell_allocator_, cells_, Capacity());
+  }
+
+  size_type Capacity() const {
+    return mask_ + 1;
+  }
+
+  size_type Size() const {
+    size_type head = dequeue_pos_.load(std::memory_order_acquire);
+    size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+    return tail > head ? std::min(tail - head, Capacity()) : 0;
+  }
+
+  bool Empty() const {
+    return Size() == 0;
+  }
+
+  EBackPressure BackPressure() const {
+    return back_pressure_;
+  }
+
+  bool Push(const value_type& item) {
+    return Emplace(item);
+  }
+
+  bool Push(value_type&& item) {
+    return Emplace(std::move(item));
+  }
+
+  template<typename... Args>
+  bool Emplace(Args&& ... args) {
+    while (!TryEmplace(std::forward<Args>(args)...)) {
+      switch (back_pressure_) {
+        case EBackPressure::kFail:
+          return false;
+        case EBackPressure::kSpin:
+          std::this_thread::yield();
+          break;
+        case EBackPressure::kOverwrite:
+          DropFront();
+          break;
+      }
+    }
+
+    return true;
+  }
+
+  bool TryPush(const value_type& item) {
+    return TryEmplace(item);
+  }
+
+  bool TryPush(value_type&& item) {
+    return TryEmplace(std::move(item));
+  }
+
+  template<typename... Args>
+  bool TryEmplace(Args&& ... args) {
+    Cell* cell;
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = cells_ + (pos & mask_);
+      size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    alloc_traits::construct(allocator_, cell->Data(), std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  bool TryPop(value_type& item) {
+    Cell* cell = AcquireFront();
+    if (!cell)
+      return false;
+    item = std::move(*cell->Data());
+    ReleaseFront(cell);
+
+    return true;
+  }
+
+ private:
+  Cell* AcquireFront() {
+    Cell* cell;
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = cells_ + (pos & mask_);
+      size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<ptrdiff_t>(sequence - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          return cell;
+      } else if (diff < 0) {
+        return 0;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void ReleaseFront(Cell* cell) {
+    size_type sequence = cell->sequence.load(std::memory_order_relaxed);
+    alloc_traits::destroy(allocator_, cell->Data());
+    cell->sequence.store(sequence + mask_, std::memory_order_release);
+  }
+
+  void DropFront() {
+    if (Cell* cell = AcquireFront())
+      ReleaseFront(cell);
+  }
+
+};
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "../CCircularBufferIter/CCircularBufferIter.h"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template<typename T, typename Alloc = std::allocator<T>>
+class CPow2CircularBuffer {
+ public:
+  typedef typename Alloc::value_type value_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef const value_type* const_pointer;
+  typedef CCircularBufferIter<CPow2CircularBuffer<T, Alloc>, nonconst_traits<Alloc>> iterator;
+  typedef CCircularBufferIter<CPow2CircularBuffer<T, Alloc>, const_traits<Alloc>> const_iterator;
+  typedef Alloc allocator_type;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+ protected:
+  pointer buffer_;
+  size_type mask_;
+  size_type head_;
+  size_type tail_;
+  Alloc allocator_;
+  template<typename Container, typename Traits> friend
+  class CCircularBufferIter;
+  typedef __gnu_cxx::__alloc_traits<allocator_type> alloc_traits;
+
+  pointer At(size_type index) const {
+    return buffer_ + ((head_ + index) & mask_);
+  }
+
+ public:
+  iterator begin() {
+    return iterator(this, 0);
+  }
+
+  const_iterator begin() const {
+    return const_iterator(this, 0);
+  }
+
+  iterator end() {
+    return iterator(this, Size());
+  }
+
+  const_iterator end() const {
+    return const_iterator(this, Size());
+  }
+
+  const_iterator cbegin() const {
+    return begin();
+  }
+
+  const_iterator cend() const {
+    return end();
+  }
+
+  size_type Size() const {
+    return tail_ - head_;
+  }
+
+  size_type Capacity() const {
+    return mask_ + 1;
+  }
+
+  bool Empty() const {
+    return head_ == tail_;
+  }
+
+  bool Full() const {
+    return Size() == Capacity();
+  }
+
+  reference operator[](size_type index) {
+    return *At(index);
+  }
+
+  const_reference operator[](size_type index) const {
+    return *At(index);
+  }
+
+  reference Front() {
+    return *At(0);
+  }
+
+  const_reference Front() const {
+    return *At(0);
+  }
+
+  reference Back() {
+    return *At(Size() - 1);
+  }
+
+  const_reference Back() const {
+    return *At(Size() - 1);
+  }
+
+  size_type MaxSize() const {
+    return alloc_traits::max_size(allocator_);
+  }
+
+  explicit CPow2CircularBuffer(const allocator_type& alloc = allocator_type())
+      : buffer_(0), mask_(-1), head_(0), tail_(0), allocator_(alloc) {}
+
+  explicit CPow2CircularBuffer(size_type capacity, const allocator_type& alloc = allocator_type())
+      : buffer_(0), mask_(-1), head_(0), tail_(0), allocator_(alloc) {
+    InitializeBuffer(capacity);
+  }
+
+  CPow2CircularBuffer(const CPow2CircularBuffer<T, Alloc>& other)
+      : buffer_(0), mask_(-1), head_(0), tail_(0),
+        allocator_(alloc_traits::_S_select_on_copy(other.allocator_)) {
+    InitializeBuffer(other.Capacity());
+    for (const auto& item : other)
+      PushBack(item);
+  }
+
+  CPow2CircularBuffer(CPow2CircularBuffer<T, Alloc>&& other) noexcept
+      : buffer_(other.buffer_), mask_(other.mask_), head_(other.head_), tail_(other.tail_),
+        allocator_(std::move(other.allocator_)) {
+    other.buffer_ = 0;
+    other.mask_ = -1;
+    other.head_ = other.tail_ = 0;
+  }
+
+  CPow2CircularBuffer(const std::initializer_list<value_type>& il, const allocator_type& alloc = allocator_type())
+      : buffer_(0), mask_(-1), head_(0), tail_(0), allocator_(alloc) {
+    InitializeBuffer(il.size());
+    for (const auto& item : il)
+      PushBack(item);
+  }
+
+  CPow2CircularBuffer<T, Alloc>& operator=(const CPow2CircularBuffer<T, Alloc>& other) {
+    if (this == &other)
+      return *this;
+    CPow2CircularBuffer copy(other);
+    swap(copy);
+
+    return *this;
+  }
+
+  CPow2CircularBuffer<T, Alloc>& operator=(CPow2CircularBuffer<T, Alloc>&& other) noexcept {
+    if (this == &other)
+      return *this;
+    CPow2CircularBuffer moved(std::move(other));
+    swap(moved);
+
+    return *this;
+  }
+
+  void PushBack(const value_type& item) {
+    EmplaceBack(item);
+  }
+
+  void PushBack(value_type&& item) {
+    EmplaceBack(std::move(item));
+  }
+
+  void PushFront(const value_type& item) {
+    EmplaceFront(item);
+  }
+
+  void PushFront(value_type&& item) {
+    EmplaceFront(std::move(item));
+  }
+
+  template<typename... Args>
+  void EmplaceBack(Args&& ... args) {
+    if (Full()) {
+      if (Empty())
+        return;
+      Overwrite(At(Size()), std::forward<Args>(args)...);
+      ++head_;
+    } else {
+      alloc_traits::construct(allocator_, std::to_address(At(Size())), std::forward<Args>(args)...);
+    }
+    ++tail_;
+  }
+
+  template<typename... Args>
+  void EmplaceFront(Args&& ... args) {
+    if (Full()) {
+      if (Empty())
+        return;
+      --tail_;
+      Overwrite(At(-1), std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(allocator_, std::to_address(At(-1)), std::forward<Args>(args)...);
+    }
+    --head_;
+  }
+
+  void PopBack() {
+    --tail_;
+    alloc_traits::destroy(allocator_, std::to_address(buffer_ + (tail_ & mask_)));
+  }
+
+  void PopFront() {
+    alloc_traits::destroy(allocator_, std::to_address(buffer_ + (head_ & mask_)));
+    ++head_;
+  }
+
+  value_type ExtractBack() {
+    value_type item(std::move(Back()));
+    PopBack();
+
+    return item;
+  }
+
+  value_type ExtractFront() {
+    value_type item(std::move(Front()));
+    PopFront();
+
+    return item;
+  }
+
+  void swap(CPow2CircularBuffer<T, Alloc>& cb) {
+    std::swap(buffer_, cb.buffer_);
+    std::swap(mask_, cb.mask_);
+    std::swap(head_, cb.head_);
+    std::swap(tail_, cb.tail_);
+    std::swap(allocator_, cb.allocator_);
+  }
+
+  void Clear() {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (; head_ != tail_; ++head_)
+        alloc_traits::destroy(allocator_, std::to_address(buffer_ + (head_ & mask_)));
+    }
+    head_ = tail_ = 0;
+  }
+
+  ~CPow2CircularBuffer() {
+    Clear();
+    if (buffer_)
+      alloc_traits::deallocate(allocator_, buffer_, Capacity());
+  }
+
+ private:
+
+  template<typename... Args>
+  void Overwrite(pointer p, Args&& ... args) {
+    if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, value_type> && ...))
+      *p = (std::forward<Args>(args), ...);
+    else
+      *p = value_type(std::forward<Args>(args)...);
+  }
+
+  void InitializeBuffer(size_type capacity) {
+    if (capacity == 0)
+      return;
+    capacity = std::bit_ceil(capacity);
+    buffer_ = alloc_traits::allocate(allocator_, capacity);
+    mask_ = capacity - 1;
+  }
+
+};
+
+template<typename T, typename Alloc>
+bool operator==(const CPow2CircularBuffer<T, Alloc>& lhs, const CPow2CircularBuffer<T, Alloc>& rhs) {
+  return lhs.Size() == rhs.Size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, typename Alloc>
+bool operator!=(const CPow2CircularBuffer<T, Alloc>& lhs, const CPow2CircularBuffer<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template<typename T, typename Alloc>
+void swap(CPow2CircularBuffer<T, Alloc>& lhs, CPow2CircularBuffer<T, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "../CByteCircularBuffer/CByteCircularBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+template<typename Alloc = std::allocator<char>>
+class CRecordCircularBuffer {
+ public:
+  typedef size_t size_type;
+  typedef uint32_t header_type;
+  typedef std::array<std::span<char>, 2> record_type;
+  typedef std::array<std::span<const char>, 2> const_record_type;
+
+  static constexpr size_type kHeaderSize = sizeof(header_type);
+
+ protected:
+  CByteCircularBuffer<Alloc> bytes_;
+  size_type records_;
+  size_type reserved_;
+
+ public:
+  explicit CRecordCircularBuffer(size_type capacity, const Alloc& alloc = Alloc())
+      : bytes_(capacity, alloc), records_(0), reserved_(0) {}
+
+  size_type Size() const {
+    return records_;
+  }
+
+  bool Empty() const {
+    return records_ == 0;
+  }
+
+  size_type Bytes() const {
+    return bytes_.Size();
+  }
+
+  size_type Capacity() const {
+    return bytes_.Capacity();
+  }
+
+  size_type MaxRecordSize() const {
+    if (Capacity() <= kHeaderSize)
+      return 0;
+
+    return std::min<size_type>(Capacity() - kHeaderSize, std::numeric_limits<header_type>::max());
+  }
+
+  record_type Reserve(size_type len) {
+    reserved_ = 0;
+    if (len > MaxRecordSize())
+      return {};
+    while (bytes_.FreeSize() < kHeaderSize + len)
+      PopFront();
+    reserved_ = len;
+
+    return Slice(bytes_.FreeSegments(), kHeaderSize, len);
+  }
+
+  void Commit() {
+    Commit(reserved_);
+  }
+
+  void Commit(size_type len) {
+    header_type header = header_type(std::min(len, reserved_));
+    record_type slot = Slice(bytes_.FreeSegments(), 0, kHeaderSize);
+    const char* src = reinterpret_cast<const char*>(&header);
+    std::copy(src, src + slot[0].size(), slot[0].begin());
+    std::copy(src + slot[0].size(), src + kHeaderSize, slot[1].begin());
+    bytes_.Commit(kHeaderSize + header);
+    ++records_;
+    reserved_ = 0;
+  }
+
+  bool Push(std::span<const char> payload) {
+    if (payload.size() > MaxRecordSize())
+      return false;
+    record_type record = Reserve(payload.size());
+    std::copy(payload.begin(), payload.begin() + record[0].size(), record[0].begin());
+    std::copy(payload.begin() + record[0].size(), payload.end(), record[1].begin());
+    Commit();
+
+    return true;
+  }
+
+  const_record_type Front() const {
+    return Slice(bytes_.Segments(), kHeaderSize, ReadHeader(0));
+  }
+
+  void PopFront() {
+    bytes_.Consume(kHeaderSize + ReadHeader(0));
+    --records_;
+  }
+
+  template<typename Function>
+  void ForEach(Function&& f) const {
+    const_record_type segments = bytes_.Segments();
+    size_type offset = 0;
+    for (size_type i = 0; i < records_; ++i) {
+      size_type len = ReadHeader(offset);
+      f(Slice(segments, offset + kHeaderSize, len));
+      offset += kHeaderSize + len;
+    }
+  }
+
+  void Clear() {
+    bytes_.Clear();
+    records_ = reserved_ = 0;
+  }
+
+ private:
+  header_type ReadHeader(size_type offset) const {
+    header_type header;
+    char* dest = reinterpret_cast<char*>(&header);
+    for (size_type i = 0; i < kHeaderSize; ++i)
+      dest[i] = bytes_[offset + i];
+
+    return header;
+  }
+
+  template<typename Char>
+  static std::array<std::span<Char>, 2> Slice(const std::array<std::span<Char>, 2>& segments, size_type offset,
+                                              size_type len) {
+    if (offset >= segments[0].size())
+      return {segments[1].subspan(offset - segments[0].size(), len), std::span<Char>()};
+    size_type head = std::min(len, segments[0].size() - offset);
+
+    return {segments[0].subspan(offset, head), segments[1].first(len - head)};
+  }
+
+};
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "../CCircularBuffer/CCircularBuffer.h"
+#include "../CCircularBufferCommon/CacheLine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+template<typename T, typename Alloc = std::allocator<T>>
+class CShardedCircularBuffer {
+ public:
+  typedef typename Alloc::value_type value_type;
+  typedef Alloc allocator_type;
+  typedef size_t size_type;
+  typedef int64_t timestamp_type;
+
+ protected:
+  struct Entry {
+    timestamp_type timestamp;
+    value_type item;
+  };
+
+  typedef typename __gnu_cxx::__alloc_traits<allocator_type>::template rebind<Entry>::other entry_allocator_type;
+  typedef CCircularBuffer<Entry, entry_allocator_type> shard_buffer_type;
+
+  struct alignas(kCacheLineSize) Shard {
+    std::mutex mutex;
+    shard_buffer_type buffer;
+    shard_buffer_type spare;
+    size_type overwrites;
+
+    Shard(size_type capacity, const entry_allocator_type& alloc)
+        : buffer(capacity, alloc), spare(capacity, alloc), overwrites(0) {}
+  };
+
+  struct SlotCacheEntry {
+    uint64_t ring;
+    size_type slot;
+  };
+
+  static constexpr size_type kSlotCacheSize = 8;
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::mutex drain_mutex_;
+  std::atomic<size_type> next_slot_;
+  const uint64_t id_;
+
+ public:
+  explicit CShardedCircularBuffer(size_type shard_capacity, size_type shards = DefaultShards(),
+                                  const allocator_type& alloc = allocator_type())
+      : next_slot_(0), id_(NextRingId()) {
+    shards = std::max<size_type>(shards, 1);
+    shards_.reserve(shards);
+    for (size_type i = 0; i < shards; ++i)
+      shards_.push_back(std::make_unique<Shard>(std::max<size_type>(shard_capacity, 1), entry_allocator_type(alloc)));
+  }
+
+  CShardedCircularBuffer(const CShardedCircularBuffer&) = delete;
+
+  CShardedCircularBuffer& operator=(const CShardedCircularBuffer&) = delete;
+
+  static size_type DefaultShards() {
+    return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+  }
+
+  size_type Shards() const {
+    return shards_.size();
+  }
+
+  size_type ShardCapacity() const {
+    return shards_.front()->buffer.Capacity();
+  }
+
+  size_type Capacity() const {
+    return Shards() * ShardCapacity();
+  }
+
+  size_type Size() const {
+    size_type size = 0;
+    for (const auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      size += shard->buffer.Size();
+    }
+
+    return size;
+  }
+
+  bool Empty() const {
+    return Size() == 0;
+  }
+
+  size_type Overwrites() const {
+    size_type overwrites = 0;
+    for (const auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      overwrites += shard->overwrites;
+    }
+
+    return overwrites;
+  }
+
+  void Push(const value_type& item) {
+    Emplace(item);
+  }
+
+  void Push(value_type&& item) {
+    Emplace(std::move(item));
+  }
+
+  template<typename... Args>
+  void Emplace(Args&& ... args) {
+    Shard& shard = *shards_[ThreadSlot() % shards_.size()];
+    timestamp_type timestamp = Now();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.overwrites += shard.buffer.Full();
+    shard.buffer.EmplaceBack(Entry{timestamp, value_type(std::forward<Args>(args)...)});
+  }
+
+  template<typename Function>
+  size_type Drain(Function&& f) {
+    std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->buffer.swap(shard->spare);
+    }
+
+    typedef std::pair<timestamp_type, size_type> head_type;
+    std::vector<head_type> heads;
+    std::vector<size_type> cursors(shards_.size(), 0);
+    heads.reserve(shards_.size());
+    for (size_type i = 0; i < shards_.size(); ++i) {
+      if (!shards_[i]->spare.Empty())
+        heads.emplace_back(shards_[i]->spare.Front().timestamp, i);
+    }
+    std::make_heap(heads.begin(), heads.end(), std::greater<head_type>());
+
+    size_type drained = 0;
+    while (!heads.empty()) {
+      std::pop_heap(heads.begin(), heads.end(), std::greater<head_type>());
+      size_type i = heads.back().second;
+      heads.pop_back();
+      shard_buffer_type& batch = shards_[i]->spare;
+      f(std::move(batch[cursors[i]++].item));
+      ++drained;
+      if (cursors[i] < batch.Size()) {
+        heads.emplace_back(batch[cursors[i]].timestamp, i);
+        std::push_heap(heads.begin(), heads.end(), std::greater<head_type>());
+      }
+    }
+    for (auto& shard : shards_)
+      shard->spare.Clear();
+
+    return drained;
+  }
+
+  void Clear() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->buffer.Clear();
+      shard->overwrites = 0;
+    }
+  }
+
+ private:
+  // Slots are handed out per ring, so every ring spreads its first threads over distinct shards. Each thread
+  // remembers its slot in a small cache keyed by ring id; ids are never reused, so a stale entry cannot match.
+  size_type ThreadSlot() {
+    thread_local SlotCacheEntry cache[kSlotCacheSize] = {};
+    SlotCacheEntry& entry = cache[id_ % kSlotCacheSize];
+    if (entry.ring != id_)
+      entry = SlotCacheEntry{id_, next_slot_.fetch_add(1, std::memory_order_relaxed)};
+
+    return entry.slot;
+  }
+
+  static uint64_t NextRingId() {
+    static std::atomic<uint64_t> next_id = 1;
+
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static timestamp_type Now() {
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+  }
+
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "../CCircularBuffer/CCircularBuffer.h"
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+template<typename T, typename Alloc = std::allocator<T>>
+class CSlidingWindow {
+ public:
+  typedef T value_type;
+  typedef const value_type& const_reference;
+  typedef size_t size_type;
+  typedef CCircularBuffer<T, Alloc> buffer_type;
+  typedef typename buffer_type::const_iterator const_iterator;
+  typedef std::conditional_t<std::is_floating_point_v<T>, double, int64_t> sum_type;
+
+ protected:
+  typedef std::pair<uint64_t, T> extremum_type;
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<extremum_type> extremum_allocator;
+
+  buffer_type values_;
+  CCircularBuffer<extremum_type, extremum_allocator> min_;
+  CCircularBuffer<extremum_type, extremum_allocator> max_;
+  uint64_t pushed_;
+  sum_type sum_;
+  sum_type compensation_;
+  double mean_;
+  double m2_;
+
+ public:
+  explicit CSlidingWindow(size_type window, const Alloc& alloc = Alloc())
+      : values_(window, alloc), min_(window, extremum_allocator(alloc)), max_(window, extremum_allocator(alloc)),
+        pushed_(0), sum_(0), compensation_(0), mean_(0), m2_(0) {}
+
+  const_iterator begin() const {
+    return values_.begin();
+  }
+
+  const_iterator end() const {
+    return values_.end();
+  }
+
+  const buffer_type& Values() const {
+    return values_;
+  }
+
+  size_type Size() const {
+    return values_.Size();
+  }
+
+  size_type Capacity() const {
+    return values_.Capacity();
+  }
+
+  bool Empty() const {
+    return values_.Empty();
+  }
+
+  bool Full() const {
+    return values_.Full();
+  }
+
+  const_reference operator[](size_type index) const {
+    return values_[index];
+  }
+
+  const_reference Front() const {
+    return values_.Front();
+  }
+
+  const_reference Back() const {
+    return values_.Back();
+  }
+
+  sum_type Sum() const {
+    return sum_;
+  }
+
+  double Mean() const {
+    return mean_;
+  }
+
+  double Variance() const {
+    return Size() > 0 ? std::max(m2_, 0.0) / double(Size()) : 0;
+  }
+
+  double SampleVariance() const {
+    return Size() > 1 ? std::max(m2_, 0.0) / double(Size() - 1) : 0;
+  }
+
+  double StdDev() const {
+    return std::sqrt(Variance());
+  }
+
+  const_reference Min() const {
+    return min_.Front().second;
+  }
+
+  const_reference Max() const {
+    return max_.Front().second;
+  }
+
+  void Push(const value_type& value) {
+    if (Capacity() == 0)
+      return;
+    if (Full())
+      Evict();
+
+    uint64_t sequence = pushed_++;
+    while (!min_.Empty() && !(min_.Back().second < value))
+      min_.PopBack();
+    min_.EmplaceBack(sequence, value);
+    while (!max_.Empty() && !(value < max_.Back().second))
+      max_.PopBack();
+    max_.EmplaceBack(sequence, value);
+
+    values_.PushBack(value);
+    Accumulate(sum_type(value));
+    double delta = double(value) - mean_;
+    mean_ += delta / double(Size());
+    m2_ += delta * (double(value) - mean_);
+  }
+
+  void Clear() {
+    values_.Clear();
+    min_.Clear();
+    max_.Clear();
+    sum_ = compensation_ = 0;
+    mean_ = m2_ = 0;
+  }
+
+ private:
+  void Evict() {
+    uint64_t sequence = pushed_ - Size();
+    if (min_.Front().first == sequence)
+      min_.PopFront();
+    if (max_.Front().first == sequence)
+      max_.PopFront();
+
+    value_type value = values_.ExtractFront();
+    Accumulate(-sum_type(value));
+    if (Empty()) {
+      mean_ = m2_ = 0;
+      return;
+    }
+    double delta = double(value) - mean_;
+    mean_ -= delta / double(Size());
+    m2_ -= delta * (double(value) - mean_);
+  }
+
+  void Accumulate(sum_type value) {
+    if constexpr (std::is_floating_point_v<sum_type>) {
+      sum_type y = value - compensation_;
+      sum_type t = sum_ + y;
+      compensation_ = (t - sum_) - y;
+      sum_ = t;
+    } else {
+      sum_ += value;
+    }
+  }
+
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "../CCircularBufferCommon/CacheLine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <utility>
+
+template<typename T, typename Alloc = std::allocator<T>>
+class CSpscCircularBuffer {
+ public:
+  typedef typename Alloc::value_type value_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef Alloc allocator_type;
+  typedef size_t size_type;
+
+ protected:
+  typedef __gnu_cxx::__alloc_traits<allocator_type> alloc_traits;
+
+  pointer buffer_;
+  size_type mask_;
+  Alloc allocator_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> head_;
+  size_type cached_tail_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> tail_;
+  size_type cached_head_;
+
+ public:
+  explicit CSpscCircularBuffer(size_type capacity, const allocator_type& alloc = allocator_type())
+      : mask_(std::bit_ceil(std::max<size_type>(capacity, 1)) - 1), allocator_(alloc),
+        head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
+    buffer_ = alloc_traits::allocate(allocator_, Capacity());
+  }
+
+  CSpscCircularBuffer(const CSpscCircularBuffer&) = delete;
+
+  CSpscCircularBuffer& operator=(const CSpscCircularBuffer&) = delete;
+
+  ~CSpscCircularBuffer() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head)
+      alloc_traits::destroy(allocator_, std::to_address(buffer_ + (head & mask_)));
+    alloc_traits::deallocate(allocator_, buffer_, Capacity());
+  }
+
+  size_type Capacity() const {
+    return mask_ + 1;
+  }
+
+  size_type Size() const {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool Empty() const {
+    return Size() == 0;
+  }
+
+  bool TryPush(const value_type& item) {
+    return TryEmplace(item);
+  }
+
+  bool TryPush(value_type&& item) {
+    return TryEmplace(std::move(item));
+  }
+
+  template<typename... Args>
+  bool TryEmplace(Args&& ... args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == Capacity()) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ == Capacity())
+        return false;
+    }
+    alloc_traits::construct(allocator_, std::to_address(buffer_ + (tail & mask_)), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  bool TryPop(value_type& item) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_)
+        return false;
+    }
+    pointer slot = buffer_ + (head & mask_);
+    item = std::move(*slot);
+    alloc_traits::destroy(allocator_, std::to_address(slot));
+    head_.store(head + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  template<typename InputIterator>
+  size_type TryPushN(InputIterator first, size_type n) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (Capacity() - (tail - cached_head_) < n)
+      cached_head_ = head_.load(std::memory_order_acquire);
+    n = std::min(n, Capacity() - (tail - cached_head_));
+    for (size_type i = 0; i < n; ++i, ++first)
+      alloc_traits::construct(allocator_, std::to_address(buffer_ + ((tail + i) & mask_)), *first);
+    tail_.store(tail + n, std::memory_order_release);
+
+    return n;
+  }
+
+  template<typename OutputIterator>
+  size_type TryPopN(OutputIterator out, size_type n) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (cached_tail_ - head < n)
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+    n = std::min(n, cached_tail_ - head);
+    for (size_type i = 0; i < n; ++i, ++out) {
+      pointer slot = buffer_ + ((head + i) & mask_);
+      *out = std::move(*slot);
+      alloc_traits::destroy(allocator_, std::to_address(slot));
+    }
+    head_.store(head + n, std::memory_order_release);
+
+    return n;
+  }
+
+};
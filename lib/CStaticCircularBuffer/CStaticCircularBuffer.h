@@ -0,0 +1,371 @@
+#pragma once
+
+#include "../CCircularBufferIter/CCircularBufferIter.h"
+
+#include <algorithm>
+#include <bit>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template<typename T, size_t N>
+class CStaticCircularBuffer {
+  static_assert(N > 0, "CStaticCircularBuffer capacity must be positive");
+
+ public:
+  typedef T value_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef const value_type* const_pointer;
+  typedef CCircularBufferIter<CStaticCircularBuffer<T, N>, nonconst_traits<std::allocator<T>>> iterator;
+  typedef CCircularBufferIter<CStaticCircularBuffer<T, N>, const_traits<std::allocator<T>>> const_iterator;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+ protected:
+  union Storage {
+    constexpr Storage() {}
+
+    constexpr ~Storage() {}
+
+    value_type data[N];
+  };
+
+  Storage storage_;
+  size_type head_;
+  size_type size_;
+  template<typename Container, typename Traits> friend
+  class CCircularBufferIter;
+
+  static constexpr size_type Wrap(size_type index) {
+    if constexpr (std::has_single_bit(N))
+      return index & (N - 1);
+    else
+      return index >= N ? index - N : index;
+  }
+
+  constexpr pointer Slot(size_type position) const {
+    return const_cast<pointer>(storage_.data + position);
+  }
+
+  constexpr pointer At(size_type index) const {
+    return Slot(Wrap(head_ + index));
+  }
+
+ public:
+  constexpr iterator begin() {
+    return iterator(this, 0);
+  }
+
+  constexpr const_iterator begin() const {
+    return const_iterator(this, 0);
+  }
+
+  constexpr iterator end() {
+    return iterator(this, size_);
+  }
+
+  constexpr const_iterator end() const {
+    return const_iterator(this, size_);
+  }
+
+  constexpr const_iterator cbegin() const {
+    return begin();
+  }
+
+  constexpr const_iterator cend() const {
+    return end();
+  }
+
+  constexpr size_type Size() const {
+    return size_;
+  }
+
+  static constexpr size_type Capacity() {
+    return N;
+  }
+
+  static constexpr size_type MaxSize() {
+    return N;
+  }
+
+  constexpr bool Empty() const {
+    return size_ == 0;
+  }
+
+  constexpr bool Full() const {
+    return size_ == N;
+  }
+
+  constexpr reference operator[](size_type index) {
+    return *At(index);
+  }
+
+  constexpr const_reference operator[](size_type index) const {
+    return *At(index);
+  }
+
+  constexpr reference Front() {
+    return *At(0);
+  }
+
+  constexpr const_reference Front() const {
+    return *At(0);
+  }
+
+  constexpr reference Back() {
+    return *At(size_ - 1);
+  }
+
+  constexpr const_reference Back() const {
+    return *At(size_ - 1);
+  }
+
+  constexpr CStaticCircularBuffer() : head_(0), size_(0) {}
+
+  constexpr CStaticCircularBuffer(size_type n, const value_type& item) : head_(0), size_(0) {
+    for (; n > 0; --n)
+      PushBack(item);
+  }
+
+  constexpr CStaticCircularBuffer(const CStaticCircularBuffer<T, N>& other) : head_(0), size_(0) {
+    for (const auto& item : other)
+      PushBack(item);
+  }
+
+  constexpr CStaticCircularBuffer(CStaticCircularBuffer<T, N>&& other)
+      noexcept(std::is_nothrow_move_constructible_v<T>) : head_(0), size_(0) {
+    for (auto& item : other)
+      PushBack(std::move(item));
+    other.Clear();
+  }
+
+  template<typename InputIterator, typename = std::_RequireInputIter<InputIterator>>
+  constexpr CStaticCircularBuffer(InputIterator first, InputIterator last) : head_(0), size_(0) {
+    for (; first != last; ++first)
+      PushBack(*first);
+  }
+
+  constexpr CStaticCircularBuffer(const std::initializer_list<value_type>& il)
+      : CStaticCircularBuffer(il.begin(), il.end()) {}
+
+  constexpr CStaticCircularBuffer<T, N>& operator=(const CStaticCircularBuffer<T, N>& other) {
+    if (this == &other)
+      return *this;
+    Clear();
+    for (const auto& item : other)
+      PushBack(item);
+
+    return *this;
+  }
+
+  constexpr CStaticCircularBuffer<T, N>& operator=(CStaticCircularBuffer<T, N>&& other)
+      noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this == &other)
+      return *this;
+    Clear();
+    for (auto& item : other)
+      PushBack(std::move(item));
+    other.Clear();
+
+    return *this;
+  }
+
+  constexpr CStaticCircularBuffer<T, N>& operator=(std::initializer_list<value_type> other) {
+    Assign(other);
+    return *this;
+  }
+
+  constexpr void Assign(size_type n, const value_type& item) {
+    Clear();
+    for (; n > 0; --n)
+      PushBack(item);
+  }
+
+  template<typename InputIterator, typename = std::_RequireInputIter<InputIterator>>
+  constexpr void Assign(InputIterator first, InputIterator last) {
+    Clear();
+    for (; first != last; ++first)
+      PushBack(*first);
+  }
+
+  constexpr void Assign(std::initializer_list<value_type> other) {
+    Assign(other.begin(), other.end());
+  }
+
+  constexpr void PushBack(const value_type& item) {
+    EmplaceBack(item);
+  }
+
+  constexpr void PushBack(value_type&& item) {
+    EmplaceBack(std::move(item));
+  }
+
+  constexpr void PushFront(const value_type& item) {
+    EmplaceFront(item);
+  }
+
+  constexpr void PushFront(value_type&& item) {
+    EmplaceFront(std::move(item));
+  }
+
+  template<typename... Args>
+  constexpr void EmplaceBack(Args&& ... args) {
+    if (Full()) {
+      Overwrite(At(0), std::forward<Args>(args)...);
+      head_ = Wrap(head_ + 1);
+    } else {
+      std::construct_at(At(size_), std::forward<Args>(args)...);
+      ++size_;
+    }
+  }
+
+  template<typename... Args>
+  constexpr void EmplaceFront(Args&& ... args) {
+    head_ = Wrap(head_ + N - 1);
+    if (Full()) {
+      Overwrite(At(0), std::forward<Args>(args)...);
+    } else {
+      std::construct_at(At(0), std::forward<Args>(args)...);
+      ++size_;
+    }
+  }
+
+  constexpr void PopBack() {
+    --size_;
+    std::destroy_at(At(size_));
+  }
+
+  constexpr void PopFront() {
+    std::destroy_at(At(0));
+    head_ = Wrap(head_ + 1);
+    --size_;
+  }
+
+  constexpr value_type ExtractBack() {
+    value_type item(std::move(Back()));
+    PopBack();
+
+    return item;
+  }
+
+  constexpr value_type ExtractFront() {
+    value_type item(std::move(Front()));
+    PopFront();
+
+    return item;
+  }
+
+  constexpr iterator Erase(const_iterator pos) {
+    return Erase(pos, pos + 1);
+  }
+
+  constexpr iterator Erase(const_iterator first, const_iterator last) {
+    size_type index = first - cbegin();
+    size_type count = last - first;
+    if (count == 0)
+      return begin() + index;
+
+    if (index < size_ - index - count) {
+      std::move_backward(begin(), begin() + index, begin() + index + count);
+      for (size_type i = 0; i < count; ++i)
+        PopFront();
+    } else {
+      std::move(begin() + index + count, end(), begin() + index);
+      for (size_type i = 0; i < count; ++i)
+        PopBack();
+    }
+
+    return begin() + index;
+  }
+
+  constexpr iterator Insert(const_iterator pos, const value_type& item) {
+    return Insert(pos, 1, item);
+  }
+
+  constexpr iterator Insert(const_iterator pos, size_type n, const value_type& value) {
+    value_type item(value);
+    return InsertN(pos - cbegin(), n, [&item]() -> const value_type& { return item; });
+  }
+
+  template<typename InputIterator, typename = std::_RequireInputIter<InputIterator>>
+  constexpr iterator Insert(const_iterator pos, InputIterator first, InputIterator last) {
+    return InsertN(pos - cbegin(), std::distance(first, last), [&first]() -> decltype(auto) { return *first++; });
+  }
+
+  constexpr iterator Insert(const_iterator pos, const std::initializer_list<value_type>& il) {
+    return Insert(pos, il.begin(), il.end());
+  }
+
+  constexpr void swap(CStaticCircularBuffer<T, N>& cb) {
+    CStaticCircularBuffer<T, N> tmp(std::move(cb));
+    cb = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  constexpr void Clear() {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < size_; ++i)
+        std::destroy_at(At(i));
+    }
+    head_ = size_ = 0;
+  }
+
+  constexpr ~CStaticCircularBuffer() {
+    Clear();
+  }
+
+ private:
+
+  template<typename Generator>
+  constexpr iterator InsertN(size_type index, size_type n, Generator next) {
+    if (size_ + n > N) {
+      size_type drop = size_ + n - N;
+      size_type drop_front = std::min(drop, index);
+      for (size_type i = 0; i < drop_front; ++i)
+        PopFront();
+      index -= drop_front;
+      for (; drop > drop_front; --drop, --n)
+        next();
+    }
+
+    if (index < size_ - index) {
+      for (size_type i = 0; i < n; ++i)
+        EmplaceFront(next());
+      std::reverse(begin(), begin() + n);
+      std::rotate(begin(), begin() + n, begin() + n + index);
+    } else {
+      for (size_type i = 0; i < n; ++i)
+        EmplaceBack(next());
+      std::rotate(begin() + index, end() - n, end());
+    }
+
+    return begin() + index;
+  }
+
+  template<typename... Args>
+  constexpr void Overwrite(pointer p, Args&& ... args) {
+    if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, value_type> && ...))
+      *p = (std::forward<Args>(args), ...);
+    else
+      *p = value_type(std::forward<Args>(args)...);
+  }
+
+};
+
+template<typename T, size_t N>
+constexpr bool operator==(const CStaticCircularBuffer<T, N>& lhs, const CStaticCircularBuffer<T, N>& rhs) {
+  return lhs.Size() == rhs.Size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, size_t N>
+constexpr bool operator!=(const CStaticCircularBuffer<T, N>& lhs, const CStaticCircularBuffer<T, N>& rhs) {
+  return !(lhs == rhs);
+}
+
+template<typename T, size_t N>
+constexpr void swap(CStaticCircularBuffer<T, N>& lhs, CStaticCircularBuffer<T, N>& rhs) {
+  lhs.swap(rhs);
+}
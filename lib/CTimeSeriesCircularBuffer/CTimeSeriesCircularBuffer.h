@@ -0,0 +1,170 @@
+#pragma once
+
+#include "../CCircularBuffer/CCircularBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+template<typename T, typename Timestamp>
+struct CTimeSample {
+  Timestamp timestamp;
+  T value;
+};
+
+template<typename Sum>
+struct CTimeWindowAggregate {
+  size_t count;
+  Sum sum;
+
+  double Mean() const {
+    return count == 0 ? 0 : double(sum) / double(count);
+  }
+};
+
+template<typename T, typename Timestamp = int64_t, typename Alloc = std::allocator<T>>
+class CTimeSeriesCircularBuffer {
+  static_assert(std::is_arithmetic_v<T>, "window aggregation needs arithmetic samples");
+
+ public:
+  typedef T value_type;
+  typedef Timestamp timestamp_type;
+  typedef CTimeSample<T, Timestamp> sample_type;
+  typedef size_t size_type;
+  typedef std::conditional_t<std::is_floating_point_v<T>, double, int64_t> sum_type;
+  typedef CTimeWindowAggregate<sum_type> aggregate_type;
+  typedef std::array<std::span<const sample_type>, 2> range_type;
+
+ protected:
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<sample_type> sample_allocator;
+  typedef typename std::allocator_traits<Alloc>::template rebind_alloc<sum_type> sum_allocator;
+  typedef CCircularBuffer<sample_type, sample_allocator> buffer_type;
+
+ public:
+  typedef typename buffer_type::const_iterator const_iterator;
+
+ protected:
+  buffer_type samples_;
+  CCircularBuffer<sum_type, sum_allocator> prefix_;
+  sum_type total_;
+  size_type since_rebase_;
+
+ public:
+  explicit CTimeSeriesCircularBuffer(size_type capacity, const Alloc& alloc = Alloc())
+      : samples_(capacity, sample_allocator(alloc)), prefix_(capacity, sum_allocator(alloc)), total_(0),
+        since_rebase_(0) {}
+
+  const_iterator begin() const {
+    return samples_.begin();
+  }
+
+  const_iterator end() const {
+    return samples_.end();
+  }
+
+  size_type Size() const {
+    return samples_.Size();
+  }
+
+  size_type Capacity() const {
+    return samples_.Capacity();
+  }
+
+  bool Empty() const {
+    return samples_.Empty();
+  }
+
+  const sample_type& Oldest() const {
+    return samples_.Front();
+  }
+
+  const sample_type& Latest() const {
+    return samples_.Back();
+  }
+
+  bool Push(timestamp_type timestamp, value_type value) {
+    if (!samples_.Empty() && timestamp < samples_.Back().timestamp)
+      return false;
+    samples_.PushBack(sample_type{timestamp, value});
+    prefix_.PushBack(total_);
+    total_ += sum_type(value);
+    if (++since_rebase_ >= Capacity())
+      Rebase();
+
+    return true;
+  }
+
+  range_type RangeByTime(timestamp_type from, timestamp_type to) const {
+    size_type first = LowerBound(from);
+    size_type last = std::max(first, LowerBound(to));
+
+    return Slice(first, last - first);
+  }
+
+  size_type EvictOlderThan(timestamp_type timestamp) {
+    size_type n = LowerBound(timestamp);
+    samples_.PopFront(n);
+    prefix_.PopFront(n);
+
+    return n;
+  }
+
+  aggregate_type Aggregate(timestamp_type from, timestamp_type to) const {
+    size_type first = LowerBound(from);
+
+    return AggregateIndices(first, std::max(first, LowerBound(to)));
+  }
+
+  template<typename Duration>
+  aggregate_type AggregateLast(const Duration& window) const {
+    if (samples_.Empty())
+      return {0, 0};
+
+    return AggregateIndices(LowerBound(Latest().timestamp - window), Size());
+  }
+
+  void Clear() {
+    samples_.Clear();
+    prefix_.Clear();
+    total_ = 0;
+    since_rebase_ = 0;
+  }
+
+ private:
+  size_type LowerBound(timestamp_type timestamp) const {
+    std::array<std::span<const sample_type>, 2> segments = samples_.Segments();
+    if (!segments[0].empty() && !(segments[0].back().timestamp < timestamp))
+      return std::ranges::lower_bound(segments[0], timestamp, {}, &sample_type::timestamp) - segments[0].begin();
+
+    return segments[0].size() +
+           (std::ranges::lower_bound(segments[1], timestamp, {}, &sample_type::timestamp) - segments[1].begin());
+  }
+
+  range_type Slice(size_type offset, size_type len) const {
+    range_type segments = samples_.Segments();
+    if (offset >= segments[0].size())
+      return {segments[1].subspan(offset - segments[0].size(), len), std::span<const sample_type>()};
+    size_type head = std::min(len, segments[0].size() - offset);
+
+    return {segments[0].subspan(offset, head), segments[1].first(len - head)};
+  }
+
+  void Rebase() {
+    sum_type base = prefix_.Empty() ? total_ : prefix_.Front();
+    for (sum_type& prefix : prefix_)
+      prefix -= base;
+    total_ -= base;
+    since_rebase_ = 0;
+  }
+
+  sum_type PrefixAt(size_type index) const {
+    return index < prefix_.Size() ? prefix_[index] : total_;
+  }
+
+  aggregate_type AggregateIndices(size_type first, size_type last) const {
+    return {last - first, PrefixAt(last) - PrefixAt(first)};
+  }
+
+};
@@ -0,0 +1,143 @@
+#include <lib/CAsyncCircularBuffer/CAsyncCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+CAsyncTask Produce(CAsyncCircularBuffer<int>& channel, int count, std::vector<int>& log) {
+  for (int i = 0; i < count; ++i) {
+    co_await channel.Push(i);
+    log.push_back(i);
+  }
+  channel.Close();
+}
+
+CAsyncTask Consume(CAsyncCircularBuffer<int>& channel, std::vector<int>& items) {
+  while (std::optional<int> item = co_await channel.Pop())
+    items.push_back(*item);
+}
+
+CAsyncTask Double(CAsyncCircularBuffer<int>& in, CAsyncCircularBuffer<int>& out) {
+  while (std::optional<int> item = co_await in.Pop())
+    co_await out.Push(*item * 2);
+  out.Close();
+}
+
+}
+
+TEST(CAsyncCircularBufferTest, PushPopTest) {
+  CAsyncExecutor executor;
+  CAsyncCircularBuffer<int> channel(executor, 4);
+  std::vector<int> log;
+  std::vector<int> items;
+  executor.Spawn(Produce(channel, 3, log));
+  executor.Run();
+
+  ASSERT_EQ(channel.Size(), 3);
+  ASSERT_TRUE(channel.Closed());
+  executor.Spawn(Consume(channel, items));
+  executor.Run();
+  ASSERT_EQ(items, std::vector<int>({0, 1, 2}));
+  ASSERT_TRUE(channel.Empty());
+}
+
+TEST(CAsyncCircularBufferTest, ConsumerSuspendsUntilPushTest) {
+  CAsyncExecutor executor;
+  CAsyncCircularBuffer<int> channel(executor, 2);
+  std::vector<int> log;
+  std::vector<int> items;
+  executor.Spawn(Consume(channel, items));
+  ASSERT_EQ(executor.Run(), 1);
+  ASSERT_EQ(executor.Pending(), 0);
+
+  executor.Spawn(Produce(channel, 5, log));
+  executor.Run();
+  ASSERT_EQ(items, std::vector<int>({0, 1, 2, 3, 4}));
+  ASSERT_EQ(log, items);
+  ASSERT_TRUE(channel.Empty());
+}
+
+TEST(CAsyncCircularBufferTest, ProducerSuspendsWhenFullTest) {
+  CAsyncExecutor executor;
+  CAsyncCircularBuffer<int> channel(executor, 2);
+  std::vector<int> log;
+  std::vector<int> items;
+  executor.Spawn(Produce(channel, 5, log));
+  executor.Run();
+
+  ASSERT_EQ(log, std::vector<int>({0, 1}));
+  ASSERT_EQ(channel.Size(), 2);
+  executor.Spawn(Consume(channel, items));
+  executor.Run();
+  ASSERT_EQ(items, std::vector<int>({0, 1, 2, 3, 4}));
+  ASSERT_EQ(log.size(), 5);
+}
+
+TEST(CAsyncCircularBufferTest, CloseResumesWaitersTest) {
+  CAsyncExecutor executor;
+  CAsyncCircularBuffer<std::string> empty(executor, 1);
+  CAsyncCircularBuffer<std::string> full(executor, 1);
+  bool popped = true;
+  bool pushed = true;
+  auto pop = [&]() -> CAsyncTask { popped = (co_await empty.Pop()).has_value(); };
+  auto push = [&]() -> CAsyncTask {
+    co_await full.Push("a");
+    pushed = co_await full.Push("b");
+  };
+  executor.Spawn(pop());
+  executor.Spawn(push());
+  executor.Run();
+
+  empty.Close();
+  full.Close();
+  executor.Run();
+  ASSERT_FALSE(popped);
+  ASSERT_FALSE(pushed);
+  ASSERT_EQ(full.Size(), 1);
+}
+
+TEST(CAsyncCircularBufferTest, ManyPipelinesTest) {
+  constexpr int kPipelines = 1000;
+  constexpr int kItems = 50;
+  CAsyncExecutor executor;
+  std::vector<std::unique_ptr<CAsyncCircularBuffer<int>>> channels;
+  std::vector<std::vector<int>> logs(kPipelines);
+  std::vector<std::vector<int>> results(kPipelines);
+  for (int i = 0; i < kPipelines; ++i) {
+    channels.push_back(std::make_unique<CAsyncCircularBuffer<int>>(executor, 4));
+    channels.push_back(std::make_unique<CAsyncCircularBuffer<int>>(executor, 4));
+    executor.Spawn(Consume(*channels[2 * i + 1], results[i]));
+    executor.Spawn(Double(*channels[2 * i], *channels[2 * i + 1]));
+    executor.Spawn(Produce(*channels[2 * i], kItems, logs[i]));
+  }
+  executor.Run();
+
+  for (int i = 0; i < kPipelines; ++i) {
+    ASSERT_EQ(results[i].size(), kItems);
+    for (int j = 0; j < kItems; ++j)
+      ASSERT_EQ(results[i][j], 2 * j);
+  }
+}
+
+TEST(CAsyncCircularBufferTest, ThrowingTaskTest) {
+  CAsyncExecutor executor;
+  CAsyncCircularBuffer<int> channel(executor, 2);
+  std::vector<int> items;
+  auto fail = [&]() -> CAsyncTask {
+    co_await channel.Push(1);
+    throw std::runtime_error("task failed");
+  };
+  executor.Spawn(fail());
+  executor.Spawn(Consume(channel, items));
+
+  ASSERT_THROW(executor.Run(), std::runtime_error);
+  ASSERT_EQ(executor.Pending(), 1);
+  channel.Close();
+  executor.Run();
+  ASSERT_EQ(items, std::vector<int>({1}));
+}
@@ -0,0 +1,185 @@
+#include <lib/CBlockingCircularBuffer/CBlockingCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+template<typename Predicate>
+void SpinUntil(Predicate ready) {
+  while (!ready())
+    std::this_thread::yield();
+}
+
+}
+
+TEST(CBlockingCircularBufferTest, PushPopTest) {
+  CBlockingCircularBuffer<std::string> queue(4);
+  ASSERT_TRUE(queue.Push("a"));
+  ASSERT_TRUE(queue.Push(std::string("b")));
+
+  std::string item;
+  ASSERT_TRUE(queue.Pop(item));
+  ASSERT_EQ(item, "a");
+  ASSERT_TRUE(queue.Pop(item, 10ms));
+  ASSERT_EQ(item, "b");
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(CBlockingCircularBufferTest, PopTimeoutTest) {
+  CBlockingCircularBuffer<int> queue(4);
+  int item = 0;
+  auto start = std::chrono::steady_clock::now();
+
+  ASSERT_FALSE(queue.Pop(item, 20ms));
+  ASSERT_GE(std::chrono::steady_clock::now() - start, 20ms);
+}
+
+TEST(CBlockingCircularBufferTest, FullPoliciesTest) {
+  CBlockingCircularBuffer<int> failing(2, EFullPolicy::kFail);
+  CBlockingCircularBuffer<int> dropping(2, EFullPolicy::kDropOldest);
+  CBlockingCircularBuffer<int> blocking(2, EFullPolicy::kBlock);
+  for (int i = 0; i < 2; ++i) {
+    failing.Push(i);
+    dropping.Push(i);
+    blocking.Push(i);
+  }
+
+  ASSERT_FALSE(failing.Push(2));
+  ASSERT_TRUE(dropping.Push(2));
+  ASSERT_FALSE(blocking.Push(2, 10ms));
+
+  std::vector<int> items(4);
+  ASSERT_EQ(dropping.PopBatch(items), 2);
+  ASSERT_EQ(items[0], 1);
+  ASSERT_EQ(items[1], 2);
+  ASSERT_EQ(failing.PopBatch(items), 2);
+  ASSERT_EQ(items[1], 1);
+}
+
+TEST(CBlockingCircularBufferTest, BlockedProducerResumesTest) {
+  CBlockingCircularBuffer<int> queue(1);
+  queue.Push(1);
+  std::atomic<bool> pushed = false;
+  std::thread producer([&] {
+    queue.Push(2);
+    pushed = true;
+  });
+
+  SpinUntil([&] { return queue.WaitingProducers() == 1; });
+  ASSERT_FALSE(pushed);
+  int item = 0;
+  ASSERT_TRUE(queue.Pop(item));
+  ASSERT_EQ(item, 1);
+  producer.join();
+  ASSERT_TRUE(pushed);
+  ASSERT_TRUE(queue.Pop(item));
+  ASSERT_EQ(item, 2);
+}
+
+TEST(CBlockingCircularBufferTest, BatchedWakeupTest) {
+  CBlockingCircularBuffer<int> queue(16, EFullPolicy::kBlock, 4);
+  std::vector<int> items(8);
+  std::future<size_t> popped = std::async(std::launch::async, [&] { return queue.PopBatch(items); });
+  SpinUntil([&] { return queue.WaitingConsumers() == 1; });
+
+  for (int i = 0; i < 3; ++i)
+    queue.Push(i);
+  ASSERT_EQ(popped.wait_for(20ms), std::future_status::timeout);
+  ASSERT_EQ(queue.WaitingConsumers(), 1);
+  queue.Push(3);
+
+  ASSERT_EQ(popped.get(), 4);
+  ASSERT_EQ(items[3], 3);
+}
+
+TEST(CBlockingCircularBufferTest, FlushWakesPartialBatchTest) {
+  CBlockingCircularBuffer<int> queue(16, EFullPolicy::kBlock, 8);
+  int item = -1;
+  std::future<bool> popped = std::async(std::launch::async, [&] { return queue.Pop(item); });
+  SpinUntil([&] { return queue.WaitingConsumers() == 1; });
+
+  queue.Push(5);
+  ASSERT_EQ(popped.wait_for(10ms), std::future_status::timeout);
+  queue.Flush();
+  ASSERT_TRUE(popped.get());
+  ASSERT_EQ(item, 5);
+}
+
+TEST(CBlockingCircularBufferTest, BatchDoesNotHoldBackQueuedItemsTest) {
+  CBlockingCircularBuffer<int> queue(16, EFullPolicy::kBlock, 8);
+  queue.Push(1);
+  queue.Push(2);
+
+  std::vector<int> items(8);
+  ASSERT_EQ(queue.PopBatch(items), 2);
+  queue.Push(3);
+  int item = 0;
+  ASSERT_TRUE(queue.Pop(item));
+  ASSERT_EQ(item, 3);
+}
+
+TEST(CBlockingCircularBufferTest, HugeTimeoutTest) {
+  CBlockingCircularBuffer<int> queue(4);
+  ASSERT_TRUE(queue.Push(1, std::chrono::nanoseconds::max()));
+  int item = 0;
+  ASSERT_TRUE(queue.Pop(item, std::chrono::hours::max()));
+  ASSERT_EQ(item, 1);
+
+  std::thread producer([&] {
+    SpinUntil([&] { return queue.WaitingConsumers() == 1; });
+    queue.Push(2);
+  });
+  ASSERT_TRUE(queue.Pop(item, std::chrono::steady_clock::duration::max()));
+  producer.join();
+  ASSERT_EQ(item, 2);
+}
+
+TEST(CBlockingCircularBufferTest, CloseWakesWaitersTest) {
+  CBlockingCircularBuffer<int> queue(4);
+  bool result = true;
+  std::thread consumer([&] {
+    int item;
+    result = queue.Pop(item);
+  });
+
+  SpinUntil([&] { return queue.WaitingConsumers() == 1; });
+  queue.Close();
+  consumer.join();
+  ASSERT_FALSE(result);
+  ASSERT_FALSE(queue.Push(1));
+}
+
+TEST(CBlockingCircularBufferTest, ProducerConsumerStressTest) {
+  constexpr int kCount = 200000;
+  CBlockingCircularBuffer<int> queue(64, EFullPolicy::kBlock, 8);
+  std::thread producer([&] {
+    for (int i = 0; i < kCount; ++i)
+      queue.Push(i);
+    queue.Close();
+  });
+
+  std::vector<int> items(16);
+  long long sum = 0;
+  int expected = 0;
+  bool ordered = true;
+  while (size_t n = queue.PopBatch(items)) {
+    for (size_t i = 0; i < n; ++i) {
+      ordered = ordered && items[i] == expected++;
+      sum += items[i];
+    }
+  }
+  producer.join();
+
+  ASSERT_TRUE(ordered);
+  ASSERT_EQ(expected, kCount);
+  ASSERT_EQ(sum, (long long) kCount * (kCount - 1) / 2);
+}
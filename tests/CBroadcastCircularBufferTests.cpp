@@ -0,0 +1,143 @@
+#include <lib/CBroadcastCircularBuffer/CBroadcastCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CBroadcastCircularBufferTest, IndependentReadersTest) {
+  CBroadcastCircularBuffer<std::string> ring(4);
+  auto first = ring.AddReader();
+  auto second = ring.AddReader();
+  ring.Push("a");
+  ring.Push("b");
+
+  std::vector<std::string> items;
+  ASSERT_EQ(first.Consume([&](const std::string& item) { items.push_back(item); }), 2);
+  ASSERT_EQ(first.Available(), 0);
+  ASSERT_EQ(second.Available(), 2);
+  std::string item;
+  ASSERT_TRUE(second.TryRead(item));
+  ASSERT_EQ(item, "a");
+  ASSERT_EQ(second.Available(), 1);
+  ASSERT_EQ(items, std::vector<std::string>({"a", "b"}));
+}
+
+TEST(CBroadcastCircularBufferTest, GateOnSlowestReaderTest) {
+  CBroadcastCircularBuffer<int> ring(4);
+  auto fast = ring.AddReader();
+  auto slow = ring.AddReader();
+  for (int i = 0; i < 4; ++i)
+    ASSERT_TRUE(ring.TryPush(i));
+  fast.Consume([](int) {});
+
+  ASSERT_FALSE(ring.TryPush(4));
+  ASSERT_EQ(slow.Consume([](int) {}, 3), 3);
+  ASSERT_TRUE(ring.TryPush(4));
+  ASSERT_TRUE(ring.TryPush(5));
+  ASSERT_TRUE(ring.TryPush(6));
+  ASSERT_FALSE(ring.TryPush(7));
+
+  std::vector<int> items(8);
+  ASSERT_EQ(slow.Read(items), 4);
+  ASSERT_EQ(items[0], 3);
+  ASSERT_EQ(items[3], 6);
+}
+
+TEST(CBroadcastCircularBufferTest, ReleasedReaderStopsGatingTest) {
+  CBroadcastCircularBuffer<int> ring(2, 1);
+  {
+    auto reader = ring.AddReader();
+    ring.Push(1);
+    ring.Push(2);
+    ASSERT_FALSE(ring.TryPush(3));
+    ASSERT_THROW(ring.AddReader(), std::length_error);
+  }
+
+  ASSERT_TRUE(ring.TryPush(3));
+  auto reader = ring.AddReader();
+  ASSERT_EQ(reader.Available(), 0);
+}
+
+TEST(CBroadcastCircularBufferTest, OverrunDetectionTest) {
+  CBroadcastCircularBuffer<int, ESlowReaderPolicy::kOverrun> ring(4);
+  auto reader = ring.AddReader();
+  for (int i = 0; i < 10; ++i)
+    ASSERT_TRUE(ring.TryPush(i));
+
+  std::vector<int> items(8);
+  ASSERT_EQ(reader.Read(items), 4);
+  ASSERT_EQ(reader.Overruns(), 6);
+  ASSERT_EQ(items[0], 6);
+  ASSERT_EQ(items[3], 9);
+  ASSERT_EQ(reader.Available(), 0);
+}
+
+TEST(CBroadcastCircularBufferTest, ConcurrentReadersTest) {
+  constexpr int kItems = 50000;
+  constexpr int kReaders = 3;
+  CBroadcastCircularBuffer<int> ring(64);
+  std::vector<CBroadcastCircularBuffer<int>::Reader> readers;
+  for (int i = 0; i < kReaders; ++i)
+    readers.push_back(ring.AddReader());
+
+  std::vector<long long> sums(kReaders, 0);
+  std::vector<std::thread> threads;
+  for (int r = 0; r < kReaders; ++r) {
+    threads.emplace_back([&, r] {
+      int expected = 0;
+      while (expected < kItems) {
+        size_t n = readers[r].Consume([&](int item) {
+          sums[r] += item == expected ? item : -1;
+          ++expected;
+        }, 16);
+        if (n == 0)
+          std::this_thread::yield();
+      }
+    });
+  }
+  for (int i = 0; i < kItems; ++i)
+    ring.Push(i);
+  for (auto& thread : threads)
+    thread.join();
+
+  for (long long sum : sums)
+    ASSERT_EQ(sum, (long long) kItems * (kItems - 1) / 2);
+}
+
+namespace {
+
+struct CStamp {
+  int64_t first;
+  int64_t second;
+};
+
+}
+
+TEST(CBroadcastCircularBufferTest, ConcurrentOverrunTest) {
+  constexpr int64_t kItems = 200000;
+  CBroadcastCircularBuffer<CStamp, ESlowReaderPolicy::kOverrun> ring(16);
+  auto reader = ring.AddReader();
+  std::thread writer([&] {
+    for (int64_t i = 0; i < kItems; ++i)
+      ring.Push({i, -i});
+  });
+
+  std::vector<CStamp> items(8);
+  int64_t read = 0;
+  int64_t last = -1;
+  bool consistent = true;
+  while (last + 1 < kItems) {
+    size_t n = reader.Read(items);
+    for (size_t i = 0; i < n; ++i) {
+      consistent = consistent && items[i].first > last && items[i].second == -items[i].first;
+      last = items[i].first;
+    }
+    read += n;
+  }
+  writer.join();
+
+  ASSERT_TRUE(consistent);
+  ASSERT_EQ(read + int64_t(reader.Overruns()), kItems);
+}
@@ -0,0 +1,120 @@
+#include <lib/CByteCircularBuffer/CByteCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+std::string Contents(const CByteCircularBuffer<>& buffer) {
+  return std::string(buffer.begin(), buffer.end());
+}
+
+void WriteAll(int fd, std::string_view data) {
+  ASSERT_EQ(write(fd, data.data(), data.size()), ssize_t(data.size()));
+}
+
+std::string ReadAll(int fd, size_t n) {
+  std::string result(n, '\0');
+  size_t done = 0;
+  while (done < n) {
+    ssize_t r = read(fd, result.data() + done, n - done);
+    if (r <= 0)
+      break;
+    done += r;
+  }
+  result.resize(done);
+
+  return result;
+}
+
+}
+
+TEST(CByteCircularBufferTest, FreeSegmentsCommitTest) {
+  CByteCircularBuffer<> buffer(8);
+  buffer.PushBack(std::span<const char>("abcdef", 6));
+  buffer.Consume(4);
+
+  auto free = buffer.FreeSegments();
+  ASSERT_EQ(free[0].size(), 2);
+  ASSERT_EQ(free[1].size(), 4);
+  std::string_view data = "123456";
+  std::copy(data.begin(), data.begin() + 2, free[0].begin());
+  std::copy(data.begin() + 2, data.end(), free[1].begin());
+  buffer.Commit(6);
+
+  ASSERT_TRUE(buffer.Full());
+  ASSERT_EQ(buffer.FreeSegments()[0].size(), 0);
+  ASSERT_EQ(Contents(buffer), "ef123456");
+}
+
+TEST(CByteCircularBufferTest, ReadFromPipeAcrossWrapTest) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  CByteCircularBuffer<> buffer(10);
+  buffer.PushBack(std::span<const char>("xxxxxxx", 7));
+  buffer.Consume(7);
+
+  WriteAll(fds[1], "0123456789abc");
+  ASSERT_EQ(buffer.ReadFrom(fds[0]), 10);
+  ASSERT_EQ(Contents(buffer), "0123456789");
+  ASSERT_EQ(buffer.ReadFrom(fds[0]), -1);
+  ASSERT_EQ(errno, ENOBUFS);
+
+  buffer.Consume(4);
+  ASSERT_EQ(buffer.ReadFrom(fds[0]), 3);
+  ASSERT_EQ(Contents(buffer), "456789abc");
+
+  close(fds[1]);
+  ASSERT_EQ(buffer.ReadFrom(fds[0]), 0);
+  close(fds[0]);
+}
+
+TEST(CByteCircularBufferTest, WriteToPipeAcrossWrapTest) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  CByteCircularBuffer<> buffer(6);
+  buffer.PushBack(std::span<const char>("....ab", 6));
+  buffer.Consume(4);
+  buffer.PushBack(std::span<const char>("cdef", 4));
+
+  ASSERT_EQ(buffer.WriteTo(fds[1]), 6);
+  ASSERT_TRUE(buffer.Empty());
+  ASSERT_EQ(buffer.WriteTo(fds[1]), 0);
+  ASSERT_EQ(ReadAll(fds[0], 6), "abcdef");
+  close(fds[0]);
+  close(fds[1]);
+}
+
+TEST(CByteCircularBufferTest, SocketPairEchoTest) {
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  ASSERT_EQ(fcntl(fds[0], F_SETFL, O_NONBLOCK), 0);
+  CByteCircularBuffer<> buffer(7);
+  std::string sent;
+  std::string received;
+
+  for (int round = 0; round < 200; ++round) {
+    std::string chunk = std::to_string(round * 7919) + ";";
+    WriteAll(fds[1], chunk);
+    sent += chunk;
+    while (buffer.ReadFrom(fds[0]) > 0 || buffer.Full()) {
+      ssize_t n = buffer.WriteTo(fds[0]);
+      ASSERT_GT(n, 0);
+      received += ReadAll(fds[1], n);
+    }
+    ASSERT_EQ(errno, EAGAIN);
+  }
+  while (!buffer.Empty())
+    received += ReadAll(fds[1], buffer.WriteTo(fds[0]));
+
+  ASSERT_EQ(received, sent);
+  close(fds[0]);
+  close(fds[1]);
+}
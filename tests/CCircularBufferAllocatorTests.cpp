@@ -0,0 +1,147 @@
+#include <lib/CCircularBufferAllocator/CCircularBufferAllocator.h>
+#include <lib/CCircularBufferExt/CCircularBufferExt.h>
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace {
+
+class CCountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+  size_t deallocations = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}
+
+TEST(CCircularBufferAllocatorTest, PoolReusesBlocksTest) {
+  CCountingResource upstream;
+  CPoolResource pool(&upstream);
+  CPoolAllocator<int> alloc(&pool);
+
+  for (int i = 0; i < 100; ++i) {
+    CCircularBufferExt<int, CPoolAllocator<int>> buffer(alloc);
+    for (int j = 0; j < 1000; ++j)
+      buffer.PushBack(j);
+    ASSERT_EQ(buffer.Size(), 1000);
+    ASSERT_EQ(buffer[999], 999);
+  }
+
+  ASSERT_LE(upstream.allocations, 11);
+  pool.Release();
+  ASSERT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(CCircularBufferAllocatorTest, PoolForwardsLargeBlocksTest) {
+  CCountingResource upstream;
+  CPoolResource pool(&upstream);
+  {
+    CCircularBuffer<char, CPoolAllocator<char>> buffer(CPoolResource::kMaxBlockSize + 1, &pool);
+    ASSERT_EQ(upstream.allocations, 1);
+  }
+  ASSERT_EQ(upstream.deallocations, 1);
+}
+
+TEST(CCircularBufferAllocatorTest, ArenaUsesInitialBufferTest) {
+  alignas(std::max_align_t) std::byte storage[1024];
+  CCountingResource upstream;
+  CArenaResource arena(storage, sizeof(storage), &upstream);
+  {
+    CCircularBuffer<int, CArenaAllocator<int>> buffer(64, &arena);
+    for (int i = 0; i < 100; ++i)
+      buffer.PushBack(i);
+    ASSERT_EQ(buffer.Front(), 36);
+    ASSERT_GE(static_cast<void*>(&buffer.Front()), static_cast<void*>(storage));
+    ASSERT_LT(static_cast<void*>(&buffer.Front()), static_cast<void*>(storage + sizeof(storage)));
+  }
+  ASSERT_EQ(upstream.allocations, 0);
+
+  CCircularBufferExt<std::string, CArenaAllocator<std::string>> strings(&arena);
+  for (int i = 0; i < 200; ++i)
+    strings.PushBack(std::to_string(i));
+  ASSERT_GT(upstream.allocations, 0);
+  ASSERT_EQ(strings.Back(), "199");
+  strings.Clear();
+  arena.Release();
+  ASSERT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(CCircularBufferAllocatorTest, AllocatorPropagationTest) {
+  CPoolResource first;
+  CPoolResource second;
+  CCircularBuffer<int, CPoolAllocator<int>> a({1, 2, 3}, &first);
+  CCircularBuffer<int, CPoolAllocator<int>> b({4, 5}, &second);
+
+  CCircularBuffer<int, CPoolAllocator<int>> copy(a);
+  ASSERT_EQ(copy.GetAllocator().GetResource(), &first);
+  b = a;
+  ASSERT_EQ(b.GetAllocator().GetResource(), &first);
+  ASSERT_EQ(b, a);
+  copy = CCircularBuffer<int, CPoolAllocator<int>>({7}, &second);
+  ASSERT_EQ(copy.GetAllocator().GetResource(), &second);
+  swap(a, copy);
+  ASSERT_EQ(a.GetAllocator().GetResource(), &second);
+  ASSERT_EQ(a.Front(), 7);
+}
+
+TEST(CCircularBufferAllocatorTest, PolymorphicAllocatorTest) {
+  std::pmr::monotonic_buffer_resource first;
+  CPoolResource second;
+  CPmrCircularBuffer<std::pmr::string> a(4, &first);
+  for (int i = 0; i < 6; ++i)
+    a.PushBack(std::pmr::string(20, char('a' + i)));
+  ASSERT_EQ(a.Front().get_allocator().resource(), &first);
+
+  CPmrCircularBuffer<std::pmr::string> b(&second);
+  b = std::move(a);
+  ASSERT_EQ(b.GetAllocator().resource(), &second);
+  ASSERT_EQ(b.Size(), 4);
+  ASSERT_EQ(b.Front(), std::pmr::string(20, 'c'));
+  ASSERT_EQ(b.Back().get_allocator().resource(), &second);
+
+  CPmrCircularBuffer<std::pmr::string> copy(b);
+  ASSERT_EQ(copy.GetAllocator().resource(), std::pmr::get_default_resource());
+  ASSERT_EQ(copy, b);
+}
+
+TEST(CCircularBufferAllocatorTest, EmptyBuffersSkipDeallocateTest) {
+  CCountingResource resource;
+  {
+    CPmrCircularBuffer<int> empty(&resource);
+    CPmrCircularBuffer<int> full(4, &resource);
+    CPmrCircularBuffer<int> moved(std::move(full));
+    CCircularBuffer<int, CResourceAllocator<int, CCountingResource>> released(&resource);
+    released.ShrinkToFit();
+
+    CPmrCircularBuffer<int, CGrowOverflow> grown(&resource);
+    grown.PushBack(1);
+    std::vector<int> items{1, 2};
+    CPmrCircularBuffer<int> assigned_n(&resource);
+    assigned_n.Assign(2, 1);
+    CPmrCircularBuffer<int> assigned_range(&resource);
+    assigned_range.Assign(items.begin(), items.end());
+    CPmrCircularBuffer<int> assigned_list(&resource);
+    assigned_list.Assign({1, 2});
+  }
+
+  ASSERT_EQ(resource.allocations, 5);
+  ASSERT_EQ(resource.deallocations, 5);
+}
@@ -0,0 +1,103 @@
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+#include <lib/CCircularBufferSimd/CCircularBufferSimd.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+template<typename T>
+class CCircularBufferSimdTest : public testing::Test {};
+
+typedef testing::Types<float, double, int64_t> SimdTypes;
+TYPED_TEST_SUITE(CCircularBufferSimdTest, SimdTypes);
+
+template<typename T>
+static CCircularBuffer<T> MakeWrapped(size_t capacity, size_t pushes, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  CCircularBuffer<T> c_buffer(capacity);
+  for (size_t i = 0; i < pushes; ++i)
+    c_buffer.PushBack(T(dist(rng)) / T(4));
+
+  return c_buffer;
+}
+
+static std::vector<ESimdLevel> SupportedLevels() {
+  std::vector<ESimdLevel> levels{ESimdLevel::kScalar};
+  if (DetectSimdLevel() >= ESimdLevel::kSse2)
+    levels.push_back(ESimdLevel::kSse2);
+  if (DetectSimdLevel() >= ESimdLevel::kAvx2)
+    levels.push_back(ESimdLevel::kAvx2);
+  return levels;
+}
+
+TYPED_TEST(CCircularBufferSimdTest, MatchesScalarReferenceTest) {
+  typedef TypeParam T;
+  for (size_t capacity : {1, 3, 7, 16, 33, 100, 1000}) {
+    CCircularBuffer<T> c_buffer = MakeWrapped<T>(capacity, capacity * 3 / 2 + 1, capacity);
+    T sum = std::accumulate(c_buffer.begin(), c_buffer.end(), T(0));
+    T min = *std::min_element(c_buffer.begin(), c_buffer.end());
+    T max = *std::max_element(c_buffer.begin(), c_buffer.end());
+    size_t above = std::count_if(c_buffer.begin(), c_buffer.end(), [](T item) { return item > T(10); });
+
+    for (ESimdLevel level : SupportedLevels()) {
+      if constexpr (std::is_floating_point_v<T>)
+        ASSERT_NEAR(AggregateSum(c_buffer, level), sum, 1e-3);
+      else
+        ASSERT_EQ(AggregateSum(c_buffer, level), sum);
+      ASSERT_EQ(AggregateMin(c_buffer, level), min);
+      ASSERT_EQ(AggregateMax(c_buffer, level), max);
+      ASSERT_EQ(AggregateCountAbove(c_buffer, T(10), level), above);
+      ASSERT_NEAR(AggregateMean(c_buffer, level), double(sum) / c_buffer.Size(), 1e-3);
+    }
+  }
+}
+
+TYPED_TEST(CCircularBufferSimdTest, EmptyBufferTest) {
+  typedef TypeParam T;
+  CCircularBuffer<T> c_buffer(8);
+
+  ASSERT_EQ(AggregateSum(c_buffer), T(0));
+  ASSERT_EQ(AggregateMean(c_buffer), 0.0);
+  ASSERT_EQ(AggregateCountAbove(c_buffer, T(0)), 0);
+  ASSERT_EQ(AggregateMin(c_buffer), kAggregateMinIdentity<T>);
+  ASSERT_EQ(AggregateMax(c_buffer), kAggregateMaxIdentity<T>);
+}
+
+TEST(CCircularBufferSimdTest, InfinitiesTest) {
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+  CCircularBuffer<double> positive(20);
+  CCircularBuffer<double> negative(20);
+  for (int i = 0; i < 27; ++i) {
+    positive.PushBack(kInf);
+    negative.PushBack(-kInf);
+  }
+
+  for (ESimdLevel level : SupportedLevels()) {
+    ASSERT_EQ(AggregateMin(positive, level), kInf);
+    ASSERT_EQ(AggregateMax(positive, level), kInf);
+    ASSERT_EQ(AggregateMin(negative, level), -kInf);
+    ASSERT_EQ(AggregateMax(negative, level), -kInf);
+  }
+
+  positive.PushBack(-kInf);
+  for (ESimdLevel level : SupportedLevels()) {
+    ASSERT_EQ(AggregateMin(positive, level), -kInf);
+    ASSERT_EQ(AggregateMax(positive, level), kInf);
+  }
+}
+
+TEST(CCircularBufferSimdTest, SpanKernelTest) {
+  std::vector<int64_t> items(37);
+  std::iota(items.begin(), items.end(), -18);
+
+  for (ESimdLevel level : SupportedLevels()) {
+    ASSERT_EQ(SpanSum<int64_t>(items, level), 0);
+    ASSERT_EQ(SpanMin<int64_t>(items, level), -18);
+    ASSERT_EQ(SpanMax<int64_t>(items, level), 18);
+    ASSERT_EQ(SpanCountAbove<int64_t>(items, 0, level), 18);
+  }
+}
@@ -3,6 +3,10 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <ranges>
+#include <sstream>
+
 TEST(CCircularBufferTest, EmptyValid) {
   CCircularBuffer<int> c_buffer;
   GTEST_ASSERT_TRUE(c_buffer.Empty());
@@ -241,3 +245,713 @@ TEST(CCircularBufferExtTest, MaxSize) {
   ASSERT_EQ(buffer_ext_i.MaxSize(), UINT64_MAX / sizeof(int));
   ASSERT_EQ(buffer_ext_c.MaxSize(), UINT64_MAX / sizeof(char));
 }
+
+
+struct CopyMoveCounter {
+  static int copies;
+  static int moves;
+
+  int value = 0;
+
+  CopyMoveCounter(int value = 0) : value(value) {}
+
+  CopyMoveCounter(const CopyMoveCounter& other) : value(other.value) { ++copies; }
+
+  CopyMoveCounter(CopyMoveCounter&& other) noexcept : value(other.value) { ++moves; }
+
+  CopyMoveCounter& operator=(const CopyMoveCounter& other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+
+  CopyMoveCounter& operator=(CopyMoveCounter&& other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+
+  static void Reset() {
+    copies = moves = 0;
+  }
+};
+
+int CopyMoveCounter::copies = 0;
+int CopyMoveCounter::moves = 0;
+
+TEST(CCircularBufferTest, PushRvalueMovesTest) {
+  CCircularBuffer<CopyMoveCounter> c_buffer(2);
+  CopyMoveCounter::Reset();
+
+  c_buffer.PushBack(CopyMoveCounter(1));
+  c_buffer.PushFront(CopyMoveCounter(0));
+  c_buffer.PushBack(CopyMoveCounter(2));
+
+  ASSERT_EQ(CopyMoveCounter::copies, 0);
+  ASSERT_EQ(CopyMoveCounter::moves, 3);
+  ASSERT_EQ(c_buffer.Front().value, 1);
+  ASSERT_EQ(c_buffer.Back().value, 2);
+}
+
+TEST(CCircularBufferTest, PushLvalueCopiesTest) {
+  CCircularBuffer<CopyMoveCounter> c_buffer(1);
+  CopyMoveCounter item(5);
+  CopyMoveCounter::Reset();
+
+  c_buffer.PushBack(item);
+  c_buffer.PushBack(item);
+
+  ASSERT_EQ(CopyMoveCounter::copies, 2);
+  ASSERT_EQ(CopyMoveCounter::moves, 0);
+}
+
+TEST(CCircularBufferTest, EmplaceTest) {
+  CCircularBuffer<std::pair<int, std::string>> c_buffer(2);
+  c_buffer.EmplaceBack(1, "b");
+  c_buffer.EmplaceFront(0, "a");
+  c_buffer.EmplaceBack(2, "c");
+
+  ASSERT_EQ(c_buffer.Size(), 2);
+  ASSERT_EQ(c_buffer.Front(), std::make_pair(1, std::string("b")));
+  ASSERT_EQ(c_buffer.Back(), std::make_pair(2, std::string("c")));
+}
+
+TEST(CCircularBufferTest, EmplaceNoCopyTest) {
+  CCircularBuffer<CopyMoveCounter> c_buffer(3);
+  CopyMoveCounter::Reset();
+
+  c_buffer.EmplaceBack(1);
+  c_buffer.EmplaceFront(0);
+
+  ASSERT_EQ(CopyMoveCounter::copies, 0);
+  ASSERT_EQ(CopyMoveCounter::moves, 0);
+}
+
+TEST(CCircularBufferTest, MoveConstructorTest) {
+  CCircularBuffer<std::string> c_buffer1{"a", "b", "c"};
+  const std::string* data = &c_buffer1.Front();
+  CCircularBuffer<std::string> c_buffer2(std::move(c_buffer1));
+
+  ASSERT_TRUE(c_buffer1.Empty());
+  ASSERT_EQ(c_buffer1.Capacity(), 0);
+  ASSERT_EQ(&c_buffer2.Front(), data);
+  ASSERT_EQ(CCircularBuffer<std::string>({"a", "b", "c"}), c_buffer2);
+}
+
+TEST(CCircularBufferTest, MoveAssignmentTest) {
+  CCircularBuffer<std::string> c_buffer1{"a", "b"};
+  CCircularBuffer<std::string> c_buffer2{"x"};
+  c_buffer2 = std::move(c_buffer1);
+
+  ASSERT_TRUE(c_buffer1.Empty());
+  ASSERT_EQ(CCircularBuffer<std::string>({"a", "b"}), c_buffer2);
+
+  c_buffer1.Reserve(1);
+  c_buffer1.PushBack("z");
+  ASSERT_EQ(c_buffer1.Front(), "z");
+}
+
+TEST(CCircularBufferTest, ExtractTest) {
+  CCircularBuffer<std::string> c_buffer{"front", "middle", "back"};
+
+  ASSERT_EQ(c_buffer.ExtractFront(), "front");
+  ASSERT_EQ(c_buffer.ExtractBack(), "back");
+  ASSERT_EQ(CCircularBuffer<std::string>({"middle"}), c_buffer);
+}
+
+TEST(CCircularBufferExtTest, GrowthMovesTest) {
+  CCircularBufferExt<CopyMoveCounter> buffer_ext(1);
+  buffer_ext.EmplaceBack(0);
+  CopyMoveCounter::Reset();
+
+  for (int i = 1; i < 8; ++i)
+    buffer_ext.EmplaceBack(i);
+
+  ASSERT_EQ(CopyMoveCounter::copies, 0);
+  ASSERT_EQ(buffer_ext.Size(), 8);
+  for (int i = 0; i < 8; ++i)
+    ASSERT_EQ(buffer_ext[i].value, i);
+}
+
+TEST(CCircularBufferExtTest, PushFrontRvalueTest) {
+  CCircularBufferExt<std::string> buffer_ext;
+  std::string item = "item";
+  buffer_ext.PushFront(std::move(item));
+  buffer_ext.PushFront("first");
+
+  ASSERT_EQ(CCircularBufferExt<std::string>({"first", "item"}), buffer_ext);
+}
+
+TEST(CCircularBufferTest, ReserveWrappedTest) {
+  CCircularBuffer<std::string> c_buffer(4);
+  for (int i = 0; i < 6; ++i)
+    c_buffer.PushBack(std::to_string(i));
+  c_buffer.Reserve(8);
+  c_buffer.PushBack("6");
+
+  ASSERT_EQ(c_buffer.Capacity(), 8);
+  ASSERT_EQ(CCircularBuffer<std::string>({"2", "3", "4", "5", "6"}), c_buffer);
+}
+
+TEST(CCircularBufferTest, ReserveTriviallyCopyableTest) {
+  CCircularBuffer<int> c_buffer(3);
+  for (int i = 0; i < 5; ++i)
+    c_buffer.PushBack(i);
+  c_buffer.PopFront();
+  c_buffer.Reserve(5);
+
+  ASSERT_EQ(CCircularBuffer<int>({3, 4}), c_buffer);
+  c_buffer.PushFront(2);
+  c_buffer.PushBack(5);
+  ASSERT_EQ(CCircularBuffer<int>({2, 3, 4, 5}), c_buffer);
+}
+
+TEST(CCircularBufferExtTest, GrowthSingleMovePerElementTest) {
+  CCircularBufferExt<CopyMoveCounter> buffer_ext(4);
+  for (int i = 0; i < 4; ++i)
+    buffer_ext.EmplaceBack(i);
+  CopyMoveCounter::Reset();
+
+  buffer_ext.EmplaceBack(4);
+
+  ASSERT_EQ(CopyMoveCounter::copies, 0);
+  ASSERT_EQ(CopyMoveCounter::moves, 5);
+  ASSERT_EQ(buffer_ext.Capacity(), 8);
+}
+
+TEST(CCircularBufferTest, EraseShiftsFrontTest) {
+  CCircularBuffer<std::string> c_buffer(6);
+  for (int i = 0; i < 9; ++i)
+    c_buffer.PushBack(std::to_string(i));
+  auto it = c_buffer.Erase(c_buffer.begin() + 1, c_buffer.begin() + 3);
+
+  ASSERT_EQ(*it, "6");
+  ASSERT_EQ(CCircularBuffer<std::string>({"3", "6", "7", "8"}), c_buffer);
+  c_buffer.PushFront("a");
+  c_buffer.PushFront("b");
+  c_buffer.PushFront("c");
+  ASSERT_EQ(CCircularBuffer<std::string>({"c", "b", "a", "3", "6", "7"}), c_buffer);
+}
+
+TEST(CCircularBufferTest, EraseShiftsBackTest) {
+  CCircularBuffer<int> c_buffer(5);
+  for (int i = 0; i < 8; ++i)
+    c_buffer.PushBack(i);
+  auto it = c_buffer.Erase(c_buffer.begin() + 3);
+
+  ASSERT_EQ(*it, 7);
+  ASSERT_EQ(CCircularBuffer<int>({3, 4, 5, 7}), c_buffer);
+  it = c_buffer.Erase(c_buffer.begin() + 2, c_buffer.end());
+  ASSERT_TRUE(it == c_buffer.end());
+  ASSERT_EQ(CCircularBuffer<int>({3, 4}), c_buffer);
+}
+
+TEST(CCircularBufferTest, EraseTouchesShorterSideTest) {
+  CCircularBuffer<CopyMoveCounter> c_buffer(10);
+  for (int i = 0; i < 10; ++i)
+    c_buffer.EmplaceBack(i);
+  CopyMoveCounter::Reset();
+
+  c_buffer.Erase(c_buffer.begin() + 1);
+  ASSERT_EQ(CopyMoveCounter::moves, 1);
+  c_buffer.Erase(c_buffer.end() - 2);
+  ASSERT_EQ(CopyMoveCounter::moves, 2);
+  ASSERT_EQ(CopyMoveCounter::copies, 0);
+
+  std::vector<int> expected{0, 2, 3, 4, 5, 6, 7, 9};
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(c_buffer[i].value, expected[i]);
+}
+
+TEST(CCircularBufferTest, InsertShiftsFrontAcrossWrapTest) {
+  CCircularBuffer<std::string> c_buffer(8);
+  for (int i = 0; i < 10; ++i)
+    c_buffer.PushBack(std::to_string(i));
+  for (int i = 0; i < 4; ++i)
+    c_buffer.PopBack();
+  auto it = c_buffer.Insert(c_buffer.begin() + 1, {"a", "b", "c"});
+
+  ASSERT_EQ(*it, "a");
+  ASSERT_EQ(CCircularBuffer<std::string>({"2", "a", "b", "c", "3", "4", "5"}), c_buffer);
+}
+
+TEST(CCircularBufferTest, InsertShiftsBackAcrossWrapTest) {
+  CCircularBuffer<int> c_buffer(8);
+  for (int i = 0; i < 10; ++i)
+    c_buffer.PushBack(i);
+  for (int i = 0; i < 3; ++i)
+    c_buffer.PopFront();
+  auto it = c_buffer.Insert(c_buffer.begin() + 3, 2, -1);
+
+  ASSERT_EQ(*it, -1);
+  ASSERT_EQ(CCircularBuffer<int>({5, 6, 7, -1, -1, 8, 9}), c_buffer);
+}
+
+TEST(CCircularBufferTest, InsertMoreThanCapacityTest) {
+  CCircularBuffer<int> c_buffer({1, 2, 3});
+  std::vector<int> items{10, 11, 12, 13};
+  c_buffer.Insert(c_buffer.begin() + 1, items.begin(), items.end());
+
+  ASSERT_EQ(CCircularBuffer<int>({13, 2, 3}), c_buffer);
+}
+
+TEST(CCircularBufferTest, InsertAliasedValueTest) {
+  CCircularBuffer<std::string> c_buffer(5);
+  c_buffer.PushBack("x");
+  c_buffer.PushBack("y");
+  c_buffer.Insert(c_buffer.begin(), 2, c_buffer.Back());
+
+  ASSERT_EQ(CCircularBuffer<std::string>({"y", "y", "x", "y"}), c_buffer);
+}
+
+TEST(CCircularBufferExtTest, InsertGrowsTest) {
+  CCircularBufferExt<std::string> buffer_ext({"a", "b"});
+  buffer_ext.Insert(buffer_ext.begin() + 1, 3, buffer_ext.Front());
+
+  ASSERT_EQ(CCircularBufferExt<std::string>({"a", "a", "a", "a", "b"}), buffer_ext);
+}
+
+TEST(CCircularBufferTest, NoVtableTest) {
+  ASSERT_FALSE(std::is_polymorphic_v<CCircularBuffer<int>>);
+  ASSERT_FALSE(std::is_polymorphic_v<CCircularBufferExt<int>>);
+  ASSERT_EQ(sizeof(CCircularBuffer<int>), 4 * sizeof(int*) + sizeof(size_t));
+}
+
+TEST(CCircularBufferTest, RejectOverflowTest) {
+  CCircularBuffer<int, std::allocator<int>, CRejectOverflow> c_buffer(3);
+  for (int i = 0; i < 5; ++i)
+    c_buffer.PushBack(i);
+  c_buffer.PushFront(-1);
+  c_buffer.Insert(c_buffer.begin() + 1, 2, 7);
+
+  ASSERT_EQ(CCircularBuffer<int>({0, 1, 2}), c_buffer);
+  c_buffer.PopFront();
+  c_buffer.PushFront(-1);
+  ASSERT_EQ(CCircularBuffer<int>({-1, 1, 2}), c_buffer);
+}
+
+struct CountingOverflow {
+  int* overflows;
+
+  template<typename Buffer>
+  EOverflowAction operator()(Buffer& buffer, size_t) {
+    ++*overflows;
+    if (buffer.Capacity() < 4) {
+      buffer.Reserve(4);
+      return EOverflowAction::kInsert;
+    }
+    return EOverflowAction::kOverwrite;
+  }
+};
+
+TEST(CCircularBufferTest, CallbackOverflowTest) {
+  int overflows = 0;
+  CCircularBuffer<std::string, std::allocator<std::string>, CCallbackOverflow<CountingOverflow>> c_buffer(2);
+  c_buffer.OverflowPolicy().callback.overflows = &overflows;
+
+  for (int i = 0; i < 6; ++i)
+    c_buffer.PushBack(std::to_string(i));
+
+  ASSERT_EQ(overflows, 3);
+  ASSERT_EQ(c_buffer.Capacity(), 4);
+  ASSERT_EQ(CCircularBuffer<std::string>({"2", "3", "4", "5"}), c_buffer);
+}
+
+TEST(CCircularBufferExtTest, GrowAliasTest) {
+  ASSERT_TRUE((std::is_same_v<CCircularBufferExt<int>, CCircularBuffer<int, std::allocator<int>, CGrowOverflow>>));
+
+  CCircularBufferExt<std::string> buffer_ext(1);
+  buffer_ext.PushBack("a");
+  buffer_ext.PushBack(buffer_ext.Front());
+  buffer_ext.PushFront(buffer_ext.Back());
+
+  ASSERT_EQ(buffer_ext.Capacity(), 4);
+  ASSERT_EQ(CCircularBuffer<std::string>({"a", "a", "a"}), buffer_ext);
+}
+
+TEST(CCircularBufferTest, ArrayOneArrayTwoTest) {
+  CCircularBuffer<int> c_buffer(5);
+  ASSERT_TRUE(c_buffer.ArrayOne().empty());
+  ASSERT_TRUE(c_buffer.ArrayTwo().empty());
+
+  for (int i = 0; i < 4; ++i)
+    c_buffer.PushBack(i);
+  ASSERT_EQ(c_buffer.ArrayOne().size(), 4);
+  ASSERT_TRUE(c_buffer.ArrayTwo().empty());
+
+  for (int i = 4; i < 8; ++i)
+    c_buffer.PushBack(i);
+  std::vector<int> one(c_buffer.ArrayOne().begin(), c_buffer.ArrayOne().end());
+  std::vector<int> two(c_buffer.ArrayTwo().begin(), c_buffer.ArrayTwo().end());
+  ASSERT_EQ(one, std::vector<int>({3, 4}));
+  ASSERT_EQ(two, std::vector<int>({5, 6, 7}));
+  ASSERT_FALSE(c_buffer.IsLinearized());
+}
+
+TEST(CCircularBufferTest, LinearizeFullTest) {
+  CCircularBuffer<std::string> c_buffer(4);
+  for (int i = 0; i < 7; ++i)
+    c_buffer.PushBack(std::to_string(i));
+
+  std::span<std::string> data = c_buffer.Linearize();
+  ASSERT_EQ(data.size(), 4);
+  ASSERT_EQ(data.data(), &c_buffer[0]);
+  ASSERT_EQ(std::vector<std::string>(data.begin(), data.end()), std::vector<std::string>({"3", "4", "5", "6"}));
+  ASSERT_TRUE(c_buffer.IsLinearized());
+
+  c_buffer.PushBack("7");
+  ASSERT_EQ(CCircularBuffer<std::string>({"4", "5", "6", "7"}), c_buffer);
+}
+
+TEST(CCircularBufferTest, LinearizeWithGapTest) {
+  CCircularBuffer<std::string> c_buffer(6);
+  for (int i = 0; i < 9; ++i)
+    c_buffer.PushBack(std::to_string(i));
+  c_buffer.PopFront();
+  c_buffer.PopFront();
+  c_buffer.PopBack();
+
+  std::span<std::string> data = c_buffer.Linearize();
+  ASSERT_EQ(std::vector<std::string>(data.begin(), data.end()), std::vector<std::string>({"5", "6", "7"}));
+  ASSERT_TRUE(c_buffer.ArrayTwo().empty());
+
+  for (int i = 9; i < 12; ++i)
+    c_buffer.PushBack(std::to_string(i));
+  c_buffer.PushFront("4");
+  ASSERT_EQ(CCircularBuffer<std::string>({"4", "5", "6", "7", "9", "10"}), c_buffer);
+}
+
+TEST(CCircularBufferTest, LinearizeTriviallyCopyableTest) {
+  CCircularBuffer<int> c_buffer(8);
+  for (int i = 0; i < 13; ++i)
+    c_buffer.PushBack(i);
+  for (int i = 0; i < 3; ++i)
+    c_buffer.PopFront();
+
+  std::span<int> data = c_buffer.Linearize();
+  std::vector<int> expected{8, 9, 10, 11, 12};
+  ASSERT_TRUE(std::equal(data.begin(), data.end(), expected.begin(), expected.end()));
+  ASSERT_EQ(data.data(), &c_buffer.Front());
+}
+
+TEST(CCircularBufferTest, PushBackSpanTest) {
+  CCircularBuffer<int> c_buffer(6);
+  std::vector<int> items{0, 1, 2, 3};
+  c_buffer.PushBack(items);
+  c_buffer.PopFront(2);
+  c_buffer.PushBack(std::span<const int>(items));
+
+  ASSERT_EQ(CCircularBuffer<int>({2, 3, 0, 1, 2, 3}), c_buffer);
+  ASSERT_FALSE(c_buffer.IsLinearized());
+}
+
+TEST(CCircularBufferTest, PushBackRangeOverwriteTest) {
+  CCircularBuffer<std::string> c_buffer(4);
+  std::vector<std::string> items{"a", "b", "c"};
+  c_buffer.PushBackRange(items.begin(), items.end());
+  c_buffer.PushBackRange(items.begin(), items.end());
+  ASSERT_EQ(CCircularBuffer<std::string>({"c", "a", "b", "c"}), c_buffer);
+
+  std::vector<std::string> many{"0", "1", "2", "3", "4", "5"};
+  c_buffer.PushBackRange(many.begin(), many.end());
+  ASSERT_EQ(CCircularBuffer<std::string>({"2", "3", "4", "5"}), c_buffer);
+}
+
+TEST(CCircularBufferTest, PushBackRangePoliciesTest) {
+  std::vector<int> items{1, 2, 3, 4, 5};
+
+  CCircularBuffer<int, std::allocator<int>, CRejectOverflow> reject_buffer(3);
+  reject_buffer.PushBack(0);
+  reject_buffer.PushBack(items);
+  ASSERT_EQ(CCircularBuffer<int>({0, 1, 2}), reject_buffer);
+
+  CCircularBufferExt<int> buffer_ext(2);
+  buffer_ext.PushBack(0);
+  buffer_ext.PushBack(items);
+  ASSERT_EQ(CCircularBuffer<int>({0, 1, 2, 3, 4, 5}), buffer_ext);
+  ASSERT_EQ(buffer_ext.Capacity(), 6);
+}
+
+struct ReservingOverflow {
+  template<typename Buffer>
+  EOverflowAction operator()(Buffer& buffer, size_t required) {
+    buffer.Reserve(2 * required);
+    return EOverflowAction::kOverwrite;
+  }
+};
+
+TEST(CCircularBufferTest, PushBackRangeAfterPolicyReserveTest) {
+  CCircularBuffer<int, std::allocator<int>, CCallbackOverflow<ReservingOverflow>> c_buffer(2);
+  std::vector<int> items{1, 2, 3};
+  c_buffer.PushBack(0);
+  c_buffer.PushBack(items);
+
+  ASSERT_EQ(c_buffer.Capacity(), 8);
+  ASSERT_EQ(CCircularBuffer<int>({0, 1, 2, 3}), c_buffer);
+}
+
+TEST(CCircularBufferTest, PushAfterPolicyReserveTest) {
+  CCircularBuffer<std::string, std::allocator<std::string>, CCallbackOverflow<ReservingOverflow>> c_buffer(2);
+  c_buffer.PushBack("1");
+  c_buffer.PushBack("2");
+  c_buffer.PushBack("3");
+  c_buffer.PushFront("0");
+
+  ASSERT_EQ(c_buffer.Capacity(), 6);
+  ASSERT_EQ(CCircularBuffer<std::string>({"0", "1", "2", "3"}), c_buffer);
+}
+
+TEST(CCircularBufferTest, PushBackInputIteratorTest) {
+  CCircularBuffer<int> c_buffer(3);
+  std::istringstream stream("1 2 3 4");
+  c_buffer.PushBackRange(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+  ASSERT_EQ(CCircularBuffer<int>({2, 3, 4}), c_buffer);
+}
+
+TEST(CCircularBufferTest, PopFrontNTest) {
+  CCircularBuffer<std::string> c_buffer(5);
+  for (int i = 0; i < 7; ++i)
+    c_buffer.PushBack(std::to_string(i));
+  c_buffer.PopFront(4);
+
+  ASSERT_EQ(CCircularBuffer<std::string>({"6"}), c_buffer);
+  c_buffer.PopFront(1);
+  ASSERT_TRUE(c_buffer.Empty());
+}
+
+TEST(CCircularBufferTest, ReadIntoTest) {
+  CCircularBuffer<int> c_buffer(5);
+  for (int i = 0; i < 8; ++i)
+    c_buffer.PushBack(i);
+
+  std::vector<int> out(4, -1);
+  ASSERT_EQ(c_buffer.ReadInto(out), 4);
+  ASSERT_EQ(out, std::vector<int>({3, 4, 5, 6}));
+  ASSERT_EQ(c_buffer.ReadInto(out), 1);
+  ASSERT_EQ(out[0], 7);
+  ASSERT_TRUE(c_buffer.Empty());
+  ASSERT_EQ(c_buffer.ReadInto(out), 0);
+}
+
+TEST(IteratorTest, RangesConceptTest) {
+  static_assert(std::random_access_iterator<CCircularBuffer<int>::iterator>);
+  static_assert(std::random_access_iterator<CCircularBuffer<int>::const_iterator>);
+  static_assert(std::ranges::random_access_range<CCircularBuffer<int>>);
+  static_assert(std::ranges::sized_range<const CCircularBuffer<int>>);
+
+  CCircularBuffer<int> c_buffer(5);
+  for (int i = 0; i < 8; ++i)
+    c_buffer.PushBack(10 - i);
+
+  std::ranges::sort(c_buffer);
+  ASSERT_EQ(CCircularBuffer<int>({3, 4, 5, 6, 7}), c_buffer);
+  ASSERT_EQ(std::ranges::distance(c_buffer), 5);
+  ASSERT_EQ(*std::ranges::find(c_buffer, 6), 6);
+}
+
+TEST(IteratorTest, IndexStableAcrossWrapTest) {
+  CCircularBuffer<int> c_buffer(4);
+  for (int i = 0; i < 6; ++i)
+    c_buffer.PushBack(i);
+
+  auto it = c_buffer.begin();
+  ASSERT_EQ(it[3], 5);
+  ASSERT_EQ(*(it + 2), 4);
+  ASSERT_EQ(c_buffer.end() - it, 4);
+  ASSERT_EQ(*(c_buffer.end() - 1), 5);
+  ASSERT_TRUE(2 + it == it + 2);
+}
+
+TEST(CCircularBufferTest, ForEachSegmentTest) {
+  CCircularBuffer<int> c_buffer(6);
+  for (int i = 0; i < 9; ++i)
+    c_buffer.PushBack(i);
+
+  int segments = 0;
+  int sum = 0;
+  c_buffer.ForEachSegment([&](std::span<int> segment) {
+    ++segments;
+    for (int& item : segment)
+      sum += item++;
+  });
+  ASSERT_EQ(segments, 2);
+  ASSERT_EQ(sum, 3 + 4 + 5 + 6 + 7 + 8);
+  ASSERT_EQ(CCircularBuffer<int>({4, 5, 6, 7, 8, 9}), c_buffer);
+
+  const auto& const_buffer = c_buffer;
+  auto joined = const_buffer.Segments() | std::views::join;
+  ASSERT_TRUE(std::ranges::equal(joined, const_buffer));
+}
+
+TEST(CCircularBufferExtTest, ShrinkToFitTest) {
+  CCircularBufferExt<std::string> buffer_ext;
+  for (int i = 0; i < 100; ++i)
+    buffer_ext.PushBack(std::to_string(i));
+  buffer_ext.PopFront(97);
+  buffer_ext.ShrinkToFit();
+
+  ASSERT_EQ(buffer_ext.Capacity(), 3);
+  ASSERT_EQ(CCircularBuffer<std::string>({"97", "98", "99"}), buffer_ext);
+  buffer_ext.Clear();
+  buffer_ext.ShrinkToFit();
+  ASSERT_EQ(buffer_ext.Capacity(), 0);
+  buffer_ext.PushBack("again");
+  ASSERT_EQ(buffer_ext.Front(), "again");
+}
+
+TEST(CCircularBufferExtTest, GrowthFactorAndCapTest) {
+  CCircularBufferExt<int, std::allocator<int>, CBasicGrowOverflow<150, 20>> buffer_ext(4);
+  std::vector<size_t> capacities;
+  for (int i = 0; i < 30; ++i) {
+    buffer_ext.PushBack(i);
+    if (capacities.empty() || capacities.back() != buffer_ext.Capacity())
+      capacities.push_back(buffer_ext.Capacity());
+  }
+
+  ASSERT_EQ(capacities, std::vector<size_t>({4, 6, 9, 13, 19, 20}));
+  ASSERT_EQ(buffer_ext.Size(), 20);
+  ASSERT_EQ(buffer_ext.Front(), 10);
+  ASSERT_EQ(buffer_ext.Back(), 29);
+
+  std::vector<int> items(25, 7);
+  buffer_ext.PushBack(items);
+  ASSERT_EQ(buffer_ext.Capacity(), 20);
+  ASSERT_EQ(buffer_ext, CCircularBuffer<int>(20, 7));
+}
+
+TEST(CCircularBufferExtTest, OscillatingWorkloadBoundedTest) {
+  CCircularBufferExt<int, std::allocator<int>, CGrowShrinkOverflow<>> buffer_ext;
+  for (int cycle = 0; cycle < 20; ++cycle) {
+    for (int i = 0; i < 5000; ++i)
+      buffer_ext.PushBack(i);
+    ASSERT_LE(buffer_ext.Capacity(), 8192);
+    while (buffer_ext.Size() > 8)
+      buffer_ext.PopFront();
+    ASSERT_LE(buffer_ext.Capacity(), 32);
+    ASSERT_GE(buffer_ext.Capacity(), 16);
+  }
+  ASSERT_EQ(buffer_ext.Back(), 4999);
+}
+
+TEST(CCircularBufferExtTest, ShrinkHysteresisTest) {
+  CCircularBufferExt<int, std::allocator<int>, CGrowShrinkOverflow<>> buffer_ext(64);
+  for (int i = 0; i < 64; ++i)
+    buffer_ext.PushBack(i);
+  while (buffer_ext.Size() > 15)
+    buffer_ext.PopBack();
+  ASSERT_EQ(buffer_ext.Capacity(), 32);
+
+  for (int i = 0; i < 1000; ++i) {
+    buffer_ext.PushBack(i);
+    buffer_ext.PushBack(i);
+    buffer_ext.PopFront();
+    buffer_ext.Erase(buffer_ext.begin());
+    ASSERT_EQ(buffer_ext.Capacity(), 32);
+  }
+}
+
+TEST(CCircularBufferStatsTest, NullStatsIsFreeTest) {
+  ASSERT_EQ(sizeof(CCircularBuffer<int>), sizeof(CCircularBuffer<int, std::allocator<int>, COverwriteOverflow,
+                                                                  CCountingStats>) - sizeof(CCountingStats));
+  CCircularBuffer<int> c_buffer(2);
+  c_buffer.PushBack(1);
+  ASSERT_EQ(c_buffer.Statistics().Snapshot().pushes, 0);
+}
+
+TEST(CCircularBufferStatsTest, FixedOverwriteCountersTest) {
+  CCircularBuffer<int, std::allocator<int>, COverwriteOverflow, CCountingStats> c_buffer(3);
+  for (int i = 0; i < 5; ++i)
+    c_buffer.PushBack(i);
+  c_buffer.PushFront(9);
+  c_buffer.PopBack();
+  c_buffer.PopFront(2);
+  c_buffer.PushBack(std::vector<int>({1, 2, 3, 4, 5, 6, 7}));
+
+  CCircularBufferStatsSnapshot stats = c_buffer.Statistics().Snapshot();
+  ASSERT_EQ(stats.pushes, 13);
+  ASSERT_EQ(stats.pops, 3);
+  ASSERT_EQ(stats.overwrites, 7);
+  ASSERT_EQ(stats.drops, 0);
+  ASSERT_EQ(stats.high_water_mark, 3);
+  ASSERT_EQ(stats.grows, 0);
+}
+
+TEST(CCircularBufferStatsTest, RejectDropCountersTest) {
+  CCircularBuffer<int, std::allocator<int>, CRejectOverflow, CCountingStats> c_buffer(2);
+  c_buffer.PushBack(std::vector<int>({1, 2, 3}));
+  c_buffer.PushFront(0);
+  c_buffer.Insert(c_buffer.begin(), 5);
+
+  CCircularBufferStatsSnapshot stats = c_buffer.Statistics().Snapshot();
+  ASSERT_EQ(stats.pushes, 2);
+  ASSERT_EQ(stats.drops, 3);
+  ASSERT_EQ(stats.overwrites, 0);
+}
+
+TEST(CCircularBufferStatsTest, ExtGrowCountersTest) {
+  CCircularBuffer<int64_t, std::allocator<int64_t>, CGrowShrinkOverflow<4, 4>, CCountingStats> buffer_ext;
+  for (int i = 0; i < 100; ++i)
+    buffer_ext.PushBack(i);
+  while (!buffer_ext.Empty())
+    buffer_ext.ExtractFront();
+
+  CCircularBufferStatsSnapshot stats = buffer_ext.Statistics().Snapshot();
+  ASSERT_EQ(stats.pushes, 100);
+  ASSERT_EQ(stats.pops, 100);
+  ASSERT_EQ(stats.high_water_mark, 100);
+  ASSERT_EQ(stats.grows, 8);
+  ASSERT_EQ(stats.shrinks, 5);
+  ASSERT_EQ(stats.reallocated_bytes, (1 + 2 + 4 + 8 + 16 + 32 + 64 + 128 + 64 + 32 + 16 + 8 + 4) * sizeof(int64_t));
+
+  buffer_ext.ResetStatistics();
+  ASSERT_EQ(buffer_ext.Statistics().Snapshot().pushes, 0);
+}
+
+TEST(CCircularBufferStatsTest, CopyKeepsPolicyAndStatsTest) {
+  typedef CCircularBuffer<int, std::allocator<int>, CCallbackOverflow<CountingOverflow>, CCountingStats> buffer_type;
+  int overflows = 0;
+  buffer_type c_buffer(4);
+  c_buffer.OverflowPolicy().callback.overflows = &overflows;
+  for (int i = 0; i < 6; ++i)
+    c_buffer.PushBack(i);
+
+  buffer_type copy(c_buffer);
+  buffer_type assigned(4);
+  assigned = c_buffer;
+  ASSERT_EQ(copy.Statistics().Snapshot().ToText(), c_buffer.Statistics().Snapshot().ToText());
+  ASSERT_EQ(assigned.Statistics().Snapshot().ToText(), c_buffer.Statistics().Snapshot().ToText());
+
+  copy.PushBack(6);
+  assigned.PushBack(6);
+  ASSERT_EQ(overflows, 4);
+  ASSERT_EQ(assigned, copy);
+}
+
+TEST(CCircularBufferStatsTest, MoveAcrossUnequalAllocatorsKeepsStatsTest) {
+  typedef CCircularBuffer<int, std::pmr::polymorphic_allocator<int>, COverwriteOverflow, CCountingStats> buffer_type;
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  buffer_type c_buffer(3, &first);
+  for (int i = 0; i < 5; ++i)
+    c_buffer.PushBack(i);
+  std::string expected = c_buffer.Statistics().Snapshot().ToText();
+
+  buffer_type moved(&second);
+  moved = std::move(c_buffer);
+  ASSERT_EQ(moved.GetAllocator().resource(), &second);
+  ASSERT_EQ(moved.Statistics().Snapshot().ToText(), expected);
+  ASSERT_EQ(std::vector<int>(moved.begin(), moved.end()), std::vector<int>({2, 3, 4}));
+}
+
+TEST(CCircularBufferStatsTest, DumpTest) {
+  CCircularBufferStatsSnapshot stats;
+  stats.pushes = 5;
+  stats.overwrites = 2;
+  stats.high_water_mark = 3;
+
+  ASSERT_EQ(stats.ToText(), "pushes=5 pops=0 overwrites=2 drops=0 grows=0 shrinks=0 reallocated_bytes=0 "
+                            "high_water_mark=3");
+  ASSERT_EQ(stats.ToJson(), "{\"pushes\":5,\"pops\":0,\"overwrites\":2,\"drops\":0,\"grows\":0,\"shrinks\":0,"
+                            "\"reallocated_bytes\":0,\"high_water_mark\":3}");
+}
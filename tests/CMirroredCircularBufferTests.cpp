@@ -0,0 +1,123 @@
+#include <lib/CMirroredCircularBuffer/CMirroredCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <string_view>
+#include <vector>
+
+TEST(CMirroredCircularBufferTest, CapacityRoundsToPagesTest) {
+  CMirroredCircularBuffer<int> buffer(10);
+
+  ASSERT_GE(buffer.Capacity(), 10);
+  ASSERT_EQ(buffer.Capacity() * sizeof(int) % sysconf(_SC_PAGESIZE), 0);
+  ASSERT_TRUE(buffer.Empty());
+}
+
+TEST(CMirroredCircularBufferTest, WrappedRangeIsContiguousTest) {
+  CMirroredCircularBuffer<int> buffer(1);
+  size_t capacity = buffer.Capacity();
+  for (size_t i = 0; i < capacity + capacity / 2; ++i)
+    buffer.PushBack(int(i));
+
+  ASSERT_TRUE(buffer.Full());
+  ASSERT_EQ(buffer.end() - buffer.begin(), capacity);
+  std::vector<int> expected(capacity);
+  std::iota(expected.begin(), expected.end(), int(capacity / 2));
+  ASSERT_TRUE(std::equal(buffer.Data(), buffer.Data() + capacity, expected.begin()));
+  ASSERT_EQ(&buffer.Back(), buffer.Data() + capacity - 1);
+}
+
+TEST(CMirroredCircularBufferTest, BytesAcrossWrapTest) {
+  CMirroredCircularBuffer<char> buffer(1);
+  std::string filler(buffer.Capacity() - 3, '.');
+  buffer.PushBack(std::span<const char>(filler.data(), filler.size()));
+  buffer.PopFront(filler.size());
+  std::string_view message = "hello, world";
+  buffer.PushBack(std::span<const char>(message.data(), message.size()));
+
+  ASSERT_EQ(std::string_view(buffer.Data(), buffer.Size()), message);
+}
+
+TEST(CMirroredCircularBufferTest, FreeSpanCommitTest) {
+  CMirroredCircularBuffer<uint8_t> buffer(1);
+  buffer.PushBack(std::vector<uint8_t>(buffer.Capacity() - 1, 0));
+  buffer.PopFront(buffer.Size());
+  std::span<uint8_t> free = buffer.FreeSpan();
+  ASSERT_EQ(free.size(), buffer.Capacity());
+  std::iota(free.begin(), free.begin() + 8, uint8_t(1));
+  buffer.Commit(8);
+
+  ASSERT_EQ(buffer.Size(), 8);
+  ASSERT_EQ(buffer.Front(), 1);
+  ASSERT_EQ(buffer.Back(), 8);
+}
+
+TEST(CMirroredCircularBufferTest, OverflowBulkPushTest) {
+  CMirroredCircularBuffer<int> buffer(1);
+  size_t capacity = buffer.Capacity();
+  std::vector<int> items(capacity * 2 + 5);
+  std::iota(items.begin(), items.end(), 0);
+  buffer.PushBack(std::span<const int>(items.data(), 7));
+  buffer.PushBack(items);
+
+  ASSERT_TRUE(buffer.Full());
+  ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), items.end() - capacity));
+}
+
+TEST(CMirroredCircularBufferTest, MatchesDequeTest) {
+  std::mt19937 rng(7);
+  CMirroredCircularBuffer<int> buffer(1);
+  std::deque<int> expected;
+  std::vector<int> out(64);
+
+  for (int step = 0; step < 20000; ++step) {
+    switch (rng() % 5) {
+      case 0:
+      case 1: {
+        buffer.PushBack(step);
+        expected.push_back(step);
+        break;
+      }
+      case 2: {
+        std::vector<int> items(rng() % 100, step);
+        buffer.PushBack(items);
+        expected.insert(expected.end(), items.begin(), items.end());
+        break;
+      }
+      case 3: {
+        size_t n = buffer.ReadInto(std::span<int>(out.data(), rng() % out.size()));
+        ASSERT_TRUE(std::equal(out.begin(), out.begin() + n, expected.begin()));
+        expected.erase(expected.begin(), expected.begin() + n);
+        break;
+      }
+      case 4: {
+        buffer.PushFront(-step);
+        expected.push_front(-step);
+        if (expected.size() > buffer.Capacity())
+          expected.pop_back();
+        break;
+      }
+    }
+    while (expected.size() > buffer.Capacity())
+      expected.pop_front();
+    ASSERT_EQ(buffer.Size(), expected.size());
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), expected.begin()));
+  }
+}
+
+TEST(CMirroredCircularBufferTest, CopyMoveTest) {
+  CMirroredCircularBuffer<int> buffer{1, 2, 3};
+  CMirroredCircularBuffer<int> copy(buffer);
+  CMirroredCircularBuffer<int> moved(std::move(buffer));
+
+  ASSERT_EQ(copy, moved);
+  ASSERT_EQ(buffer.Capacity(), 0);
+  copy.PopFront();
+  ASSERT_NE(copy, moved);
+  moved = copy;
+  ASSERT_EQ(copy, moved);
+}
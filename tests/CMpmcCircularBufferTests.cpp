@@ -0,0 +1,102 @@
+#include <lib/CMpmcCircularBuffer/CMpmcCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CMpmcCircularBufferTest, FailWhenFullTest) {
+  CMpmcCircularBuffer<std::string> c_buffer(4);
+  std::string item;
+
+  ASSERT_FALSE(c_buffer.TryPop(item));
+  for (int i = 0; i < 4; ++i)
+    ASSERT_TRUE(c_buffer.Push(std::to_string(i)));
+  ASSERT_FALSE(c_buffer.Push("full"));
+  ASSERT_EQ(c_buffer.Size(), 4);
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(c_buffer.TryPop(item));
+    ASSERT_EQ(item, std::to_string(i));
+  }
+  ASSERT_TRUE(c_buffer.Empty());
+}
+
+TEST(CMpmcCircularBufferTest, OverwriteOldestTest) {
+  CMpmcCircularBuffer<int> c_buffer(4, EBackPressure::kOverwrite);
+  for (int i = 0; i < 10; ++i)
+    ASSERT_TRUE(c_buffer.Push(i));
+
+  int item;
+  for (int i = 6; i < 10; ++i) {
+    ASSERT_TRUE(c_buffer.TryPop(item));
+    ASSERT_EQ(item, i);
+  }
+  ASSERT_FALSE(c_buffer.TryPop(item));
+}
+
+TEST(CMpmcCircularBufferTest, SpinWaitsForConsumerTest) {
+  CMpmcCircularBuffer<int> c_buffer(2, EBackPressure::kSpin);
+  c_buffer.Push(0);
+  c_buffer.Push(1);
+
+  std::thread consumer([&c_buffer]() {
+    int item;
+    while (!c_buffer.TryPop(item))
+      std::this_thread::yield();
+  });
+  ASSERT_TRUE(c_buffer.Push(2));
+  consumer.join();
+
+  int item;
+  ASSERT_TRUE(c_buffer.TryPop(item));
+  ASSERT_EQ(item, 1);
+  ASSERT_TRUE(c_buffer.TryPop(item));
+  ASSERT_EQ(item, 2);
+}
+
+TEST(CMpmcCircularBufferTest, StressTest) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 50000;
+  CMpmcCircularBuffer<int> c_buffer(128, EBackPressure::kSpin);
+  std::atomic<int64_t> sum(0);
+  std::atomic<int> popped(0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&c_buffer, t]() {
+      for (int i = 0; i < kPerThread; ++i)
+        c_buffer.Push(t * kPerThread + i);
+    });
+    threads.emplace_back([&c_buffer, &sum, &popped]() {
+      int item;
+      while (popped.load() < kThreads * kPerThread) {
+        if (c_buffer.TryPop(item)) {
+          sum += item;
+          ++popped;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  int64_t total = int64_t(kThreads) * kPerThread;
+  ASSERT_EQ(popped.load(), total);
+  ASSERT_EQ(sum.load(), total * (total - 1) / 2);
+  ASSERT_TRUE(c_buffer.Empty());
+}
+
+TEST(CMpmcCircularBufferTest, DestroysRemainingTest) {
+  auto item = std::make_shared<int>(1);
+  {
+    CMpmcCircularBuffer<std::shared_ptr<int>> c_buffer(4, EBackPressure::kOverwrite);
+    for (int i = 0; i < 6; ++i)
+      c_buffer.Push(item);
+    ASSERT_EQ(item.use_count(), 5);
+  }
+  ASSERT_EQ(item.use_count(), 1);
+}
@@ -0,0 +1,142 @@
+#include <lib/CPow2CircularBuffer/CPow2CircularBuffer.h>
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+namespace {
+
+template<typename T>
+struct CCountingAllocator {
+  typedef T value_type;
+
+  size_t* allocations;
+
+  explicit CCountingAllocator(size_t* counter) : allocations(counter) {}
+
+  template<typename U>
+  CCountingAllocator(const CCountingAllocator<U>& other) : allocations(other.allocations) {}
+
+  T* allocate(size_t n) {
+    ++*allocations;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, size_t n) {
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const CCountingAllocator& other) const {
+    return allocations == other.allocations;
+  }
+};
+
+}
+
+TEST(CPow2CircularBufferTest, CapacityRoundedTest) {
+  CPow2CircularBuffer<int> c_buffer(5);
+  CPow2CircularBuffer<int> c_buffer2(8);
+  CPow2CircularBuffer<int> c_buffer3;
+
+  ASSERT_EQ(c_buffer.Capacity(), 8);
+  ASSERT_EQ(c_buffer2.Capacity(), 8);
+  ASSERT_EQ(c_buffer3.Capacity(), 0);
+  ASSERT_TRUE(c_buffer.Empty());
+}
+
+TEST(CPow2CircularBufferTest, PushOverwriteTest) {
+  CPow2CircularBuffer<int> c_buffer(4);
+  for (int i = 0; i < 10; ++i)
+    c_buffer.PushBack(i);
+
+  ASSERT_TRUE(c_buffer.Full());
+  ASSERT_EQ(CPow2CircularBuffer<int>({6, 7, 8, 9}), c_buffer);
+
+  c_buffer.PushFront(5);
+  ASSERT_EQ(CPow2CircularBuffer<int>({5, 6, 7, 8}), c_buffer);
+}
+
+TEST(CPow2CircularBufferTest, PushPopFrontBackTest) {
+  CPow2CircularBuffer<std::string> c_buffer(4);
+  c_buffer.PushFront("b");
+  c_buffer.PushFront("a");
+  c_buffer.PushBack("c");
+
+  ASSERT_EQ(c_buffer.Front(), "a");
+  ASSERT_EQ(c_buffer.Back(), "c");
+  ASSERT_EQ(c_buffer[1], "b");
+  ASSERT_EQ(c_buffer.ExtractFront(), "a");
+  c_buffer.PopBack();
+  ASSERT_EQ(c_buffer.Size(), 1);
+  ASSERT_EQ(c_buffer.Front(), "b");
+}
+
+TEST(CPow2CircularBufferTest, MatchesCCircularBufferTest) {
+  CPow2CircularBuffer<int> pow2_buffer(16);
+  CCircularBuffer<int> c_buffer(16);
+  for (int i = 0; i < 100; ++i) {
+    if (i % 3 == 0) {
+      pow2_buffer.PushFront(i);
+      c_buffer.PushFront(i);
+    } else if (i % 7 == 0) {
+      pow2_buffer.PopBack();
+      c_buffer.PopBack();
+    } else {
+      pow2_buffer.PushBack(i);
+      c_buffer.PushBack(i);
+    }
+    ASSERT_EQ(pow2_buffer.Size(), c_buffer.Size());
+    ASSERT_TRUE(std::equal(pow2_buffer.begin(), pow2_buffer.end(), c_buffer.begin()));
+  }
+}
+
+TEST(CPow2CircularBufferTest, IteratorTest) {
+  CPow2CircularBuffer<int> c_buffer(4);
+  for (int i = 0; i < 6; ++i)
+    c_buffer.PushBack(5 - i);
+
+  std::sort(c_buffer.begin(), c_buffer.end());
+  ASSERT_EQ(CPow2CircularBuffer<int>({0, 1, 2, 3}), c_buffer);
+  ASSERT_EQ(c_buffer.end() - c_buffer.begin(), 4);
+  ASSERT_EQ(*(c_buffer.cbegin() + 2), 2);
+  ASSERT_TRUE(c_buffer.begin() < c_buffer.cend());
+}
+
+TEST(CPow2CircularBufferTest, CopyMoveTest) {
+  CPow2CircularBuffer<std::string> c_buffer1{"a", "b", "c"};
+  CPow2CircularBuffer<std::string> c_buffer2(c_buffer1);
+  ASSERT_EQ(c_buffer1, c_buffer2);
+
+  CPow2CircularBuffer<std::string> c_buffer3(std::move(c_buffer1));
+  ASSERT_TRUE(c_buffer1.Empty());
+  ASSERT_EQ(c_buffer2, c_buffer3);
+
+  c_buffer1 = c_buffer3;
+  c_buffer3 = std::move(c_buffer2);
+  ASSERT_EQ(c_buffer1, c_buffer3);
+}
+
+TEST(CPow2CircularBufferTest, EmptyBufferTest) {
+  CPow2CircularBuffer<int> c_buffer;
+  c_buffer.PushBack(1);
+  c_buffer.PushFront(2);
+  ASSERT_TRUE(c_buffer.Empty());
+  ASSERT_TRUE(c_buffer.Full());
+
+  CPow2CircularBuffer<int> c_buffer2(4);
+  CPow2CircularBuffer<int> c_buffer3(std::move(c_buffer2));
+  ASSERT_EQ(c_buffer2.Capacity(), 0);
+  ASSERT_EQ(c_buffer3.Capacity(), 4);
+}
+
+TEST(CPow2CircularBufferTest, CopyKeepsAllocatorTest) {
+  size_t allocations = 0;
+  CPow2CircularBuffer<int, CCountingAllocator<int>> c_buffer(4, CCountingAllocator<int>(&allocations));
+  c_buffer.PushBack(1);
+  CPow2CircularBuffer<int, CCountingAllocator<int>> copy(c_buffer);
+
+  ASSERT_EQ(allocations, 2);
+  ASSERT_EQ(copy, c_buffer);
+}
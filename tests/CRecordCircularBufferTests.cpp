@@ -0,0 +1,112 @@
+#include <lib/CRecordCircularBuffer/CRecordCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+template<typename Record>
+std::string ToString(const Record& record) {
+  return std::string(record[0].begin(), record[0].end()) + std::string(record[1].begin(), record[1].end());
+}
+
+bool Push(CRecordCircularBuffer<>& buffer, std::string_view payload) {
+  return buffer.Push(std::span<const char>(payload.data(), payload.size()));
+}
+
+std::vector<std::string> Records(const CRecordCircularBuffer<>& buffer) {
+  std::vector<std::string> result;
+  buffer.ForEach([&](const auto& record) { result.push_back(ToString(record)); });
+
+  return result;
+}
+
+}
+
+TEST(CRecordCircularBufferTest, PushPopTest) {
+  CRecordCircularBuffer<> buffer(64);
+  ASSERT_TRUE(Push(buffer, "first"));
+  ASSERT_TRUE(Push(buffer, ""));
+  ASSERT_TRUE(Push(buffer, "third record"));
+
+  ASSERT_EQ(buffer.Size(), 3);
+  ASSERT_EQ(buffer.Bytes(), 3 * buffer.kHeaderSize + 17);
+  ASSERT_EQ(ToString(buffer.Front()), "first");
+  buffer.PopFront();
+  ASSERT_EQ(ToString(buffer.Front()), "");
+  buffer.PopFront();
+  ASSERT_EQ(ToString(buffer.Front()), "third record");
+}
+
+TEST(CRecordCircularBufferTest, EvictsWholeRecordsTest) {
+  CRecordCircularBuffer<> buffer(32);
+  Push(buffer, "aaaaaaaa");
+  Push(buffer, "bbbbbbbb");
+  Push(buffer, "cccccccc");
+
+  ASSERT_EQ(Records(buffer), std::vector<std::string>({"bbbbbbbb", "cccccccc"}));
+  Push(buffer, "dddddddddddddddddddd");
+  ASSERT_EQ(Records(buffer), std::vector<std::string>({"dddddddddddddddddddd"}));
+}
+
+TEST(CRecordCircularBufferTest, ReserveCommitAcrossWrapTest) {
+  CRecordCircularBuffer<> buffer(24);
+  Push(buffer, "01234567");
+  Push(buffer, "xy");
+  buffer.PopFront();
+
+  auto record = buffer.Reserve(12);
+  ASSERT_EQ(buffer.Size(), 1);
+  ASSERT_FALSE(record[1].empty());
+  std::string_view payload = "wrapped!";
+  std::copy(payload.begin(), payload.begin() + std::min(payload.size(), record[0].size()), record[0].begin());
+  if (payload.size() > record[0].size())
+    std::copy(payload.begin() + record[0].size(), payload.end(), record[1].begin());
+  buffer.Commit(payload.size());
+
+  ASSERT_EQ(Records(buffer), std::vector<std::string>({"xy", "wrapped!"}));
+  ASSERT_EQ(buffer.Bytes(), 2 * buffer.kHeaderSize + 10);
+}
+
+TEST(CRecordCircularBufferTest, RejectsOversizedTest) {
+  CRecordCircularBuffer<> buffer(16);
+  Push(buffer, "keep");
+
+  ASSERT_FALSE(Push(buffer, std::string(buffer.MaxRecordSize() + 1, 'x')));
+  ASSERT_EQ(Records(buffer), std::vector<std::string>({"keep"}));
+  ASSERT_TRUE(Push(buffer, std::string(buffer.MaxRecordSize(), 'x')));
+  ASSERT_EQ(buffer.Size(), 1);
+}
+
+TEST(CRecordCircularBufferTest, MatchesDequeTest) {
+  std::mt19937 rng(11);
+  CRecordCircularBuffer<> buffer(257);
+  std::deque<std::string> expected;
+  size_t bytes = 0;
+
+  for (int step = 0; step < 5000; ++step) {
+    if (rng() % 4 == 0 && !expected.empty()) {
+      ASSERT_EQ(ToString(buffer.Front()), expected.front());
+      bytes -= buffer.kHeaderSize + expected.front().size();
+      expected.pop_front();
+      buffer.PopFront();
+      continue;
+    }
+    std::string payload(rng() % 60, char('a' + step % 26));
+    while (bytes + buffer.kHeaderSize + payload.size() > buffer.Capacity()) {
+      bytes -= buffer.kHeaderSize + expected.front().size();
+      expected.pop_front();
+    }
+    Push(buffer, payload);
+    expected.push_back(payload);
+    bytes += buffer.kHeaderSize + payload.size();
+
+    ASSERT_EQ(buffer.Bytes(), bytes);
+    ASSERT_EQ(Records(buffer), std::vector<std::string>(expected.begin(), expected.end()));
+  }
+}
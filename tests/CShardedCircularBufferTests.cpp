@@ -0,0 +1,91 @@
+#include <lib/CShardedCircularBuffer/CShardedCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CShardedCircularBufferTest, SingleThreadOrderTest) {
+  CShardedCircularBuffer<std::string> buffer(8, 4);
+  ASSERT_EQ(buffer.Shards(), 4);
+  ASSERT_EQ(buffer.Capacity(), 32);
+  buffer.Push("a");
+  buffer.Push(std::string("b"));
+  buffer.Emplace(2, 'c');
+  ASSERT_EQ(buffer.Size(), 3);
+
+  std::vector<std::string> items;
+  ASSERT_EQ(buffer.Drain([&](std::string&& item) { items.push_back(std::move(item)); }), 3);
+  ASSERT_EQ(items, std::vector<std::string>({"a", "b", "cc"}));
+  ASSERT_TRUE(buffer.Empty());
+}
+
+TEST(CShardedCircularBufferTest, OverwriteOldestPerShardTest) {
+  CShardedCircularBuffer<int> buffer(4, 2);
+  for (int i = 0; i < 10; ++i)
+    buffer.Push(i);
+
+  std::vector<int> items;
+  buffer.Drain([&](int item) { items.push_back(item); });
+  ASSERT_EQ(items, std::vector<int>({6, 7, 8, 9}));
+  ASSERT_EQ(buffer.Overwrites(), 6);
+}
+
+TEST(CShardedCircularBufferTest, MergeAcrossThreadsTest) {
+  constexpr int kThreads = 4;
+  constexpr int kItems = 1000;
+  CShardedCircularBuffer<std::pair<int, int>> buffer(kItems, kThreads);
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreads; ++t) {
+    producers.emplace_back([&buffer, t] {
+      for (int i = 0; i < kItems; ++i)
+        buffer.Push({t, i});
+    });
+  }
+  for (auto& producer : producers)
+    producer.join();
+
+  std::vector<int> next(kThreads, 0);
+  bool ordered = true;
+  size_t drained = buffer.Drain([&](const std::pair<int, int>& item) {
+    ordered = ordered && item.second == next[item.first]++;
+  });
+  ASSERT_EQ(drained, kThreads * kItems);
+  ASSERT_TRUE(ordered);
+  ASSERT_EQ(buffer.Overwrites(), 0);
+}
+
+TEST(CShardedCircularBufferTest, SlotsArePerRingTest) {
+  CShardedCircularBuffer<int> first(1, 2);
+  CShardedCircularBuffer<int> second(1, 2);
+  for (int i = 0; i < 4; ++i) {
+    CShardedCircularBuffer<int>& buffer = i % 2 == 0 ? first : second;
+    std::thread([&buffer, i] { buffer.Push(i); }).join();
+  }
+
+  ASSERT_EQ(first.Size(), 2);
+  ASSERT_EQ(second.Size(), 2);
+  ASSERT_EQ(first.Overwrites(), 0);
+  ASSERT_EQ(second.Overwrites(), 0);
+}
+
+TEST(CShardedCircularBufferTest, ConcurrentDrainTest) {
+  constexpr int kItems = 20000;
+  CShardedCircularBuffer<int> buffer(kItems, 2);
+  std::thread producer([&] {
+    for (int i = 0; i < kItems; ++i)
+      buffer.Push(i);
+  });
+
+  std::vector<int> items;
+  auto collect = [&](int item) { items.push_back(item); };
+  while (items.size() < kItems) {
+    buffer.Drain(collect);
+    std::this_thread::yield();
+  }
+  producer.join();
+
+  for (int i = 0; i < kItems; ++i)
+    ASSERT_EQ(items[i], i);
+}
@@ -0,0 +1,78 @@
+#include <lib/CSlidingWindow/CSlidingWindow.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+TEST(CSlidingWindowTest, EmptyTest) {
+  CSlidingWindow<double> window(4);
+
+  ASSERT_TRUE(window.Empty());
+  ASSERT_EQ(window.Sum(), 0);
+  ASSERT_EQ(window.Mean(), 0);
+  ASSERT_EQ(window.Variance(), 0);
+}
+
+TEST(CSlidingWindowTest, EvictsOldestTest) {
+  CSlidingWindow<int> window(3);
+  for (int value : {5, 1, 4, 2, 8})
+    window.Push(value);
+
+  ASSERT_EQ(window.Size(), 3);
+  ASSERT_EQ(window.Sum(), 14);
+  ASSERT_EQ(window.Min(), 2);
+  ASSERT_EQ(window.Max(), 8);
+  ASSERT_DOUBLE_EQ(window.Mean(), 14.0 / 3);
+  ASSERT_EQ(std::vector<int>(window.begin(), window.end()), std::vector<int>({4, 2, 8}));
+}
+
+TEST(CSlidingWindowTest, MatchesRecomputedStatsTest) {
+  std::mt19937 rng(3);
+  std::normal_distribution<double> dist(100.0, 15.0);
+  CSlidingWindow<double> window(64);
+
+  for (int i = 0; i < 5000; ++i) {
+    window.Push(dist(rng));
+
+    double sum = std::accumulate(window.begin(), window.end(), 0.0);
+    double mean = sum / window.Size();
+    double m2 = 0;
+    for (double value : window)
+      m2 += (value - mean) * (value - mean);
+
+    ASSERT_NEAR(window.Sum(), sum, 1e-9);
+    ASSERT_NEAR(window.Mean(), mean, 1e-9);
+    ASSERT_NEAR(window.Variance(), m2 / window.Size(), 1e-6);
+    ASSERT_EQ(window.Min(), *std::min_element(window.begin(), window.end()));
+    ASSERT_EQ(window.Max(), *std::max_element(window.begin(), window.end()));
+  }
+}
+
+TEST(CSlidingWindowTest, DuplicateExtremaTest) {
+  CSlidingWindow<int> window(3);
+  for (int value : {7, 7, 1, 7}) {
+    window.Push(value);
+    ASSERT_EQ(window.Max(), 7);
+  }
+  ASSERT_EQ(window.Min(), 1);
+  window.Push(9);
+  window.Push(9);
+  ASSERT_EQ(window.Min(), 7);
+  ASSERT_EQ(window.Max(), 9);
+}
+
+TEST(CSlidingWindowTest, ClearTest) {
+  CSlidingWindow<int64_t> window(2);
+  window.Push(10);
+  window.Push(20);
+  window.Clear();
+  window.Push(3);
+
+  ASSERT_EQ(window.Sum(), 3);
+  ASSERT_EQ(window.Min(), 3);
+  ASSERT_EQ(window.Max(), 3);
+  ASSERT_EQ(window.Variance(), 0);
+}
@@ -0,0 +1,105 @@
+#include <lib/CSpscCircularBuffer/CSpscCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CSpscCircularBufferTest, PushPopTest) {
+  CSpscCircularBuffer<std::string> c_buffer(3);
+  std::string item;
+
+  ASSERT_EQ(c_buffer.Capacity(), 4);
+  ASSERT_FALSE(c_buffer.TryPop(item));
+  for (int i = 0; i < 4; ++i)
+    ASSERT_TRUE(c_buffer.TryPush(std::to_string(i)));
+  ASSERT_FALSE(c_buffer.TryPush("full"));
+  ASSERT_EQ(c_buffer.Size(), 4);
+
+  ASSERT_TRUE(c_buffer.TryPop(item));
+  ASSERT_EQ(item, "0");
+  ASSERT_TRUE(c_buffer.TryEmplace(2, 'x'));
+  for (const char* expected : {"1", "2", "3", "xx"}) {
+    ASSERT_TRUE(c_buffer.TryPop(item));
+    ASSERT_EQ(item, expected);
+  }
+  ASSERT_TRUE(c_buffer.Empty());
+}
+
+TEST(CSpscCircularBufferTest, BatchTest) {
+  CSpscCircularBuffer<int> c_buffer(8);
+  std::vector<int> items{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<int> out(10, -1);
+
+  ASSERT_EQ(c_buffer.TryPushN(items.begin(), 10), 8);
+  ASSERT_EQ(c_buffer.TryPopN(out.begin(), 3), 3);
+  ASSERT_EQ(c_buffer.TryPushN(items.begin() + 8, 2), 2);
+  ASSERT_EQ(c_buffer.TryPopN(out.begin() + 3, 10), 7);
+  ASSERT_EQ(items, out);
+}
+
+TEST(CSpscCircularBufferTest, StressTest) {
+  constexpr int kCount = 200000;
+  CSpscCircularBuffer<int> c_buffer(64);
+
+  std::thread producer([&c_buffer]() {
+    for (int i = 0; i < kCount; ++i)
+      while (!c_buffer.TryPush(i))
+        std::this_thread::yield();
+  });
+
+  bool ordered = true;
+  int value;
+  for (int i = 0; i < kCount; ++i) {
+    while (!c_buffer.TryPop(value))
+      std::this_thread::yield();
+    ordered &= value == i;
+  }
+  producer.join();
+
+  ASSERT_TRUE(ordered);
+  ASSERT_TRUE(c_buffer.Empty());
+}
+
+TEST(CSpscCircularBufferTest, BatchStressTest) {
+  constexpr int kCount = 200000;
+  CSpscCircularBuffer<int> c_buffer(256);
+
+  std::thread producer([&c_buffer]() {
+    std::vector<int> batch(37);
+    for (int next = 0; next < kCount;) {
+      int n = std::min<int>(batch.size(), kCount - next);
+      for (int i = 0; i < n; ++i)
+        batch[i] = next + i;
+      int pushed = c_buffer.TryPushN(batch.begin(), n);
+      if (pushed == 0)
+        std::this_thread::yield();
+      next += pushed;
+    }
+  });
+
+  bool ordered = true;
+  std::vector<int> batch(53);
+  for (int expected = 0; expected < kCount;) {
+    size_t n = c_buffer.TryPopN(batch.begin(), batch.size());
+    if (n == 0)
+      std::this_thread::yield();
+    for (size_t i = 0; i < n; ++i)
+      ordered &= batch[i] == expected++;
+  }
+  producer.join();
+
+  ASSERT_TRUE(ordered);
+}
+
+TEST(CSpscCircularBufferTest, DestroysRemainingTest) {
+  auto item = std::make_shared<int>(1);
+  {
+    CSpscCircularBuffer<std::shared_ptr<int>> c_buffer(4);
+    c_buffer.TryPush(item);
+    c_buffer.TryPush(item);
+    ASSERT_EQ(item.use_count(), 3);
+  }
+  ASSERT_EQ(item.use_count(), 1);
+}
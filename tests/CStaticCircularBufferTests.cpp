@@ -0,0 +1,111 @@
+#include <lib/CStaticCircularBuffer/CStaticCircularBuffer.h>
+#include <lib/CCircularBuffer/CCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+constexpr int ConstexprSum() {
+  CStaticCircularBuffer<int, 3> c_buffer;
+  for (int i = 1; i <= 5; ++i)
+    c_buffer.PushBack(i);
+  c_buffer.PushFront(10);
+
+  int sum = 0;
+  for (int item : c_buffer)
+    sum += item;
+
+  return sum;
+}
+
+constexpr bool ConstexprInsertErase() {
+  CStaticCircularBuffer<int, 8> c_buffer{1, 2, 3, 4, 5};
+  c_buffer.Erase(c_buffer.begin() + 1);
+  c_buffer.Insert(c_buffer.begin() + 3, {7, 8});
+
+  return c_buffer == CStaticCircularBuffer<int, 8>{1, 3, 4, 7, 8, 5};
+}
+
+static_assert(ConstexprSum() == 10 + 3 + 4);
+static_assert(ConstexprInsertErase());
+static_assert(CStaticCircularBuffer<int, 64>::Capacity() == 64);
+
+struct CThrowingMove {
+  CThrowingMove() = default;
+  CThrowingMove(const CThrowingMove&) = default;
+  CThrowingMove(CThrowingMove&&) noexcept(false) {}
+  CThrowingMove& operator=(const CThrowingMove&) = default;
+};
+
+static_assert(std::is_nothrow_move_constructible_v<CStaticCircularBuffer<std::string, 4>>);
+static_assert(std::is_nothrow_move_assignable_v<CStaticCircularBuffer<std::string, 4>>);
+static_assert(!std::is_nothrow_move_constructible_v<CStaticCircularBuffer<CThrowingMove, 4>>);
+static_assert(!std::is_nothrow_move_assignable_v<CStaticCircularBuffer<CThrowingMove, 4>>);
+
+TEST(CStaticCircularBufferTest, InlineStorageTest) {
+  ASSERT_EQ(sizeof(CStaticCircularBuffer<int, 64>), 64 * sizeof(int) + 2 * sizeof(size_t));
+  CStaticCircularBuffer<int, 64> c_buffer;
+  ASSERT_TRUE(c_buffer.Empty());
+  ASSERT_EQ(c_buffer.Capacity(), 64);
+}
+
+TEST(CStaticCircularBufferTest, PushOverwriteTest) {
+  CStaticCircularBuffer<std::string, 3> c_buffer;
+  for (int i = 0; i < 5; ++i)
+    c_buffer.PushBack(std::to_string(i));
+
+  ASSERT_TRUE(c_buffer.Full());
+  ASSERT_EQ((CStaticCircularBuffer<std::string, 3>{"2", "3", "4"}), c_buffer);
+  c_buffer.PushFront("1");
+  ASSERT_EQ((CStaticCircularBuffer<std::string, 3>{"1", "2", "3"}), c_buffer);
+  ASSERT_EQ(c_buffer.ExtractBack(), "3");
+  ASSERT_EQ(c_buffer.ExtractFront(), "1");
+  ASSERT_EQ(c_buffer.Front(), "2");
+}
+
+TEST(CStaticCircularBufferTest, MatchesCCircularBufferTest) {
+  CStaticCircularBuffer<int, 7> static_buffer;
+  CCircularBuffer<int> c_buffer(7);
+  for (int i = 0; i < 60; ++i) {
+    if (i % 5 == 0) {
+      static_buffer.Insert(static_buffer.begin() + static_buffer.Size() / 2, 2, i);
+      c_buffer.Insert(c_buffer.begin() + c_buffer.Size() / 2, 2, i);
+    } else if (i % 7 == 0) {
+      static_buffer.Erase(static_buffer.begin() + 1, static_buffer.begin() + 3);
+      c_buffer.Erase(c_buffer.begin() + 1, c_buffer.begin() + 3);
+    } else if (i % 3 == 0) {
+      static_buffer.PushFront(i);
+      c_buffer.PushFront(i);
+    } else {
+      static_buffer.PushBack(i);
+      c_buffer.PushBack(i);
+    }
+    ASSERT_EQ(static_buffer.Size(), c_buffer.Size());
+    ASSERT_TRUE(std::equal(static_buffer.begin(), static_buffer.end(), c_buffer.begin()));
+  }
+}
+
+TEST(CStaticCircularBufferTest, CopyMoveSwapTest) {
+  CStaticCircularBuffer<std::string, 4> c_buffer1{"a", "b"};
+  CStaticCircularBuffer<std::string, 4> c_buffer2(c_buffer1);
+  ASSERT_EQ(c_buffer1, c_buffer2);
+
+  CStaticCircularBuffer<std::string, 4> c_buffer3(std::move(c_buffer1));
+  ASSERT_TRUE(c_buffer1.Empty());
+  ASSERT_EQ(c_buffer2, c_buffer3);
+
+  c_buffer1 = {"x"};
+  swap(c_buffer1, c_buffer3);
+  ASSERT_EQ((CStaticCircularBuffer<std::string, 4>{"x"}), c_buffer3);
+  ASSERT_EQ(c_buffer1, c_buffer2);
+}
+
+TEST(CStaticCircularBufferTest, SortTest) {
+  CStaticCircularBuffer<int, 5> c_buffer;
+  for (int i = 0; i < 8; ++i)
+    c_buffer.PushBack(8 - i);
+
+  std::sort(c_buffer.begin(), c_buffer.end());
+  ASSERT_EQ((CStaticCircularBuffer<int, 5>{1, 2, 3, 4, 5}), c_buffer);
+}
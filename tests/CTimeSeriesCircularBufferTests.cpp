@@ -0,0 +1,110 @@
+#include <lib/CTimeSeriesCircularBuffer/CTimeSeriesCircularBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+namespace {
+
+template<typename Range>
+std::vector<int64_t> Timestamps(const Range& range) {
+  std::vector<int64_t> timestamps;
+  for (const auto& segment : range) {
+    for (const auto& sample : segment)
+      timestamps.push_back(sample.timestamp);
+  }
+
+  return timestamps;
+}
+
+}
+
+TEST(CTimeSeriesCircularBufferTest, RangeByTimeTest) {
+  CTimeSeriesCircularBuffer<int> series(8);
+  for (int i = 0; i < 12; ++i)
+    ASSERT_TRUE(series.Push(i * 10, i));
+
+  ASSERT_EQ(series.Oldest().timestamp, 40);
+  ASSERT_FALSE(series.RangeByTime(0, 200)[1].empty());
+  ASSERT_EQ(Timestamps(series.RangeByTime(0, 200)), std::vector<int64_t>({40, 50, 60, 70, 80, 90, 100, 110}));
+  ASSERT_EQ(Timestamps(series.RangeByTime(55, 100)), std::vector<int64_t>({60, 70, 80, 90}));
+  ASSERT_EQ(Timestamps(series.RangeByTime(85, 95)), std::vector<int64_t>({90}));
+  ASSERT_TRUE(Timestamps(series.RangeByTime(100, 60)).empty());
+  ASSERT_TRUE(Timestamps(series.RangeByTime(111, 500)).empty());
+}
+
+TEST(CTimeSeriesCircularBufferTest, OutOfOrderPushTest) {
+  CTimeSeriesCircularBuffer<double> series(4);
+  ASSERT_TRUE(series.Push(10, 1.0));
+  ASSERT_TRUE(series.Push(10, 2.0));
+  ASSERT_FALSE(series.Push(9, 3.0));
+  ASSERT_EQ(series.Size(), 2);
+  ASSERT_EQ(series.Latest().value, 2.0);
+}
+
+TEST(CTimeSeriesCircularBufferTest, EvictOlderThanTest) {
+  CTimeSeriesCircularBuffer<int> series(8);
+  for (int i = 0; i < 10; ++i)
+    series.Push(i, i);
+
+  ASSERT_EQ(series.EvictOlderThan(5), 3);
+  ASSERT_EQ(series.Oldest().timestamp, 5);
+  ASSERT_EQ(series.EvictOlderThan(5), 0);
+  ASSERT_EQ(series.EvictOlderThan(100), 5);
+  ASSERT_TRUE(series.Empty());
+  ASSERT_TRUE(series.Push(3, 3));
+}
+
+TEST(CTimeSeriesCircularBufferTest, AggregateTest) {
+  CTimeSeriesCircularBuffer<int> series(6);
+  for (int i = 1; i <= 10; ++i)
+    series.Push(i * 100, i);
+
+  auto all = series.Aggregate(0, 2000);
+  ASSERT_EQ(all.count, 6);
+  ASSERT_EQ(all.sum, 5 + 6 + 7 + 8 + 9 + 10);
+  auto middle = series.Aggregate(650, 900);
+  ASSERT_EQ(middle.count, 2);
+  ASSERT_EQ(middle.sum, 15);
+  ASSERT_DOUBLE_EQ(middle.Mean(), 7.5);
+
+  auto last = series.AggregateLast(200);
+  ASSERT_EQ(last.count, 3);
+  ASSERT_EQ(last.sum, 27);
+  series.EvictOlderThan(900);
+  ASSERT_EQ(series.Aggregate(0, 2000).sum, 19);
+  ASSERT_EQ(series.Aggregate(2000, 3000).count, 0);
+}
+
+TEST(CTimeSeriesCircularBufferTest, ChronoTimestampTest) {
+  typedef std::chrono::steady_clock::time_point time_point;
+  using namespace std::chrono_literals;
+  CTimeSeriesCircularBuffer<double, time_point> series(16);
+  time_point start;
+  for (int i = 0; i < 10; ++i)
+    series.Push(start + i * 1min, 1.5);
+
+  auto window = series.AggregateLast(5min);
+  ASSERT_EQ(window.count, 6);
+  ASSERT_DOUBLE_EQ(window.sum, 9.0);
+  ASSERT_EQ(series.RangeByTime(start + 2min, start + 4min)[0].size(), 2);
+}
+
+TEST(CTimeSeriesCircularBufferTest, LongStreamPrefixRebaseTest) {
+  constexpr int64_t kLarge = 1'000'000'000'000'000;
+  CTimeSeriesCircularBuffer<int64_t> integers(16);
+  for (int64_t i = 0; i < 100000; ++i)
+    integers.Push(i, kLarge);
+  ASSERT_EQ(integers.AggregateLast(7).sum, 8 * kLarge);
+  ASSERT_EQ(integers.Aggregate(0, 200000).sum, 16 * kLarge);
+
+  CTimeSeriesCircularBuffer<double> doubles(16);
+  for (int64_t i = 0; i < 200000; ++i)
+    doubles.Push(i, 1e12);
+  for (int64_t i = 200000; i < 200040; ++i)
+    doubles.Push(i, 0.001);
+  auto window = doubles.AggregateLast(15);
+  ASSERT_EQ(window.count, 16);
+  ASSERT_NEAR(window.sum, 0.016, 1e-12);
+}